@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Microbenchmark of sf::priv::sinCosDegrees against libm
+//
+// Computes the sines and cosines of 60000 angles, as many as
+// the rotating sprites of a busy scene, with the scalar and
+// the array functions and with std::sin and std::cos. Build
+// with and without SFML_FAST_SINCOS to compare both paths.
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SinCos.hpp"
+#include "Clock.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+namespace
+{
+    const std::size_t angleCount = 60000;
+    const int         runCount   = 200;
+
+    // Prints the average time of a run, in milliseconds
+    void report(const char* name, sf::Time time)
+    {
+        std::printf("%-28s %8.3f ms\n", name, time.asMicroseconds() / 1000.0 / runCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<float> angles(angleCount);
+    std::vector<float> sines(angleCount);
+    std::vector<float> cosines(angleCount);
+    for (std::size_t i = 0; i < angleCount; ++i)
+        angles[i] = i * 0.37f - 10000.f;
+
+    // Sum of the results, printed so that no loop is optimized away
+    double checksum = 0;
+
+#ifdef SFML_FAST_SINCOS
+    std::printf("SFML_FAST_SINCOS, %lu angles\n", static_cast<unsigned long>(angleCount));
+#else
+    std::printf("Default path, %lu angles\n", static_cast<unsigned long>(angleCount));
+#endif
+
+    sf::Clock clock;
+    for (int run = 0; run < runCount; ++run)
+    {
+        for (std::size_t i = 0; i < angleCount; ++i)
+            sf::priv::sinCosDegrees(angles[i] + run, sines[i], cosines[i]);
+        checksum += sines[run] + cosines[run];
+    }
+    report("sinCosDegrees (scalar)", clock.restart());
+
+    for (int run = 0; run < runCount; ++run)
+    {
+        angles[run] += 1.f;
+        sf::priv::sinCosDegrees(&angles[0], &sines[0], &cosines[0], angleCount);
+        checksum += sines[run] + cosines[run];
+    }
+    report("sinCosDegrees (array)", clock.restart());
+
+    for (int run = 0; run < runCount; ++run)
+    {
+        for (std::size_t i = 0; i < angleCount; ++i)
+        {
+            float radians = (angles[i] + run) * 3.141592654f / 180.f;
+            sines[i]   = std::sin(radians);
+            cosines[i] = std::cos(radians);
+        }
+        checksum += sines[run] + cosines[run];
+    }
+    report("std::sin + std::cos (float)", clock.restart());
+
+    std::printf("checksum %g\n", checksum);
+
+    return 0;
+}
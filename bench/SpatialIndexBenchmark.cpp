@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Benchmark of sf::SpatialIndex against a linear scan
+//
+// One million entries of sprite-sized bounds are spread over
+// a 100000x100000 world, half of them are moved and some are
+// removed and inserted again, then the visible area of random
+// 1920x1080 views is queried. The candidates of the tree are
+// filtered with Rect::intersects on their exact bounds, and
+// the result must be exactly the set found by testing every
+// entry with Rect::intersects.
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SpatialIndex.hpp"
+#include "Clock.hpp"
+#include "View.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+namespace
+{
+    const int   entryCount = 1000000;
+    const int   queryCount = 200;
+    const float worldSize  = 100000.f;
+
+    // Deterministic random numbers in [0, 1)
+    unsigned int seed = 1;
+    float randomUnit()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) / 16777216.f;
+    }
+
+    float toMilliseconds(sf::Time time)
+    {
+        return time.asMicroseconds() / 1000.f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<sf::FloatRect> bounds(entryCount);
+    std::vector<int>           entries(entryCount);
+    sf::SpatialIndex           index;
+
+    // Build
+    sf::Clock clock;
+    for (int i = 0; i < entryCount; ++i)
+    {
+        bounds[i]  = sf::FloatRect(randomUnit() * worldSize, randomUnit() * worldSize, 4.f + randomUnit() * 60.f, 4.f + randomUnit() * 60.f);
+        entries[i] = index.insert(bounds[i], &bounds[i]);
+    }
+    std::printf("Insert %d entries:   %9.3f ms (height %d)\n", entryCount, toMilliseconds(clock.restart()), index.getHeight());
+
+    // Incremental updates, as objects move
+    for (int i = 0; i < entryCount; i += 2)
+    {
+        bounds[i].left += randomUnit() * 10.f - 5.f;
+        bounds[i].top  += randomUnit() * 10.f - 5.f;
+        index.update(entries[i], bounds[i]);
+    }
+    std::printf("Update %d entries:    %9.3f ms\n", entryCount / 2, toMilliseconds(clock.restart()));
+
+    // Removals, and some entries coming back
+    for (int i = 0; i < entryCount; i += 10)
+    {
+        index.remove(entries[i]);
+        entries[i] = -1;
+    }
+    for (int i = 0; i < entryCount; i += 20)
+        entries[i] = index.insert(bounds[i], &bounds[i]);
+    std::printf("Remove and reinsert:       %9.3f ms (%lu entries)\n", toMilliseconds(clock.restart()),
+                static_cast<unsigned long>(index.getEntryCount()));
+
+    // View queries
+    sf::Time treeTime;
+    sf::Time filterTime;
+    sf::Time scanTime;
+    std::size_t found      = 0;
+    int         mismatches = 0;
+    std::vector<void*> candidates;
+    std::vector<void*> visible;
+    std::vector<void*> expected;
+
+    for (int q = 0; q < queryCount; ++q)
+    {
+        sf::View view(sf::FloatRect(randomUnit() * worldSize, randomUnit() * worldSize, 1920.f, 1080.f));
+        if (q % 2)
+            view.setRotation(randomUnit() * 360.f);
+        sf::FloatRect area = view.getInverseTransform().transformRect(sf::FloatRect(-1.f, -1.f, 2.f, 2.f));
+
+        candidates.clear();
+        visible.clear();
+        expected.clear();
+
+        clock.restart();
+        index.query(view, candidates);
+        treeTime += clock.restart();
+
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            if (area.intersects(*static_cast<const sf::FloatRect*>(candidates[i])))
+                visible.push_back(candidates[i]);
+        }
+        filterTime += clock.restart();
+
+        for (int i = 0; i < entryCount; ++i)
+        {
+            if ((entries[i] >= 0) && area.intersects(bounds[i]))
+                expected.push_back(&bounds[i]);
+        }
+        scanTime += clock.restart();
+
+        std::sort(visible.begin(), visible.end());
+        if (visible != expected)
+            ++mismatches;
+
+        found += visible.size();
+    }
+
+    std::printf("View query, tree:          %9.3f ms (%lu visible on average)\n", toMilliseconds(treeTime) / queryCount,
+                static_cast<unsigned long>(found / queryCount));
+    std::printf("View query, tree + exact:  %9.3f ms\n", toMilliseconds(treeTime + filterTime) / queryCount);
+    std::printf("View query, linear scan:   %9.3f ms\n", toMilliseconds(scanTime) / queryCount);
+    std::printf("Queries whose result differs from the scan: %d\n", mismatches);
+
+    return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_CACHESTATE_HPP
+#define SFML_CACHESTATE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include <atomic>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Publication state of a lazily computed value
+///
+/// Several threads may read the value at once: the first one
+/// finding it stale computes it, while the others wait for it
+/// to be published. Once published, reading it costs a single
+/// atomic load. Modifying the inputs of the value (and calling
+/// invalidate) must not happen while other threads read it.
+///
+/// \code
+/// if (!m_state.isValid() && m_state.beginUpdate())
+/// {
+///     m_value = compute();
+///     m_state.endUpdate();
+/// }
+/// return m_value;
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class CacheState
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The value starts stale.
+    ///
+    ////////////////////////////////////////////////////////////
+    CacheState();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy State to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    CacheState(const CacheState& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right State to copy
+    ///
+    /// \return Reference to *this
+    ///
+    ////////////////////////////////////////////////////////////
+    CacheState& operator =(const CacheState& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the value as stale
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the value is published
+    ///
+    /// \return True if the value can be read
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isValid() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Claim the computation of a stale value
+    ///
+    /// If another thread is computing the value, this waits
+    /// until it is published.
+    ///
+    /// \return True if the caller must compute the value and
+    ///         call endUpdate, false if it was published meanwhile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool beginUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Publish the value computed after beginUpdate
+    ///
+    ////////////////////////////////////////////////////////////
+    void endUpdate() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::atomic<int> m_state; ///< Stale, being computed or published
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_CACHESTATE_HPP
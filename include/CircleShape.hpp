@@ -111,8 +111,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     ///< Radius of the circle
-    std::size_t m_pointCount; ///< Number of points composing the circle
+    float            m_radius;     ///< Radius of the circle
+    std::size_t      m_pointCount; ///< Number of points composing the circle
+    const iVector2f* m_unitPoints; ///< Points of the unit circle with m_pointCount points, shared by every circle
 };
 
 } // namespace sf
@@ -149,6 +150,11 @@ private:
 /// small numbers you can create any regular polygon shape:
 /// equilateral triangle, square, pentagon, hexagon, ...
 ///
+/// The points of a circle are those of a unit circle scaled by
+/// its radius; the unit circle of each point count is computed
+/// once and shared by every circle, so changing the radius
+/// doesn't evaluate any sine or cosine.
+///
 /// \see sf::Shape, sf::RectangleShape, sf::ConvexShape
 ///
 ////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
+#include <algorithm>
 
 
 namespace sf
@@ -48,7 +49,7 @@ public:
     /// sf::iColor(0, 0, 0, 255).
     ///
     ////////////////////////////////////////////////////////////
-    iColor();
+    constexpr iColor();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the color from its 4 RGBA components
@@ -59,7 +60,7 @@ public:
     /// \param alpha Alpha (opacity) component (in the range [0, 255])
     ///
     ////////////////////////////////////////////////////////////
-    iColor(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha = 255);
+    constexpr iColor(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha = 255);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the color from 32-bit unsigned integer
@@ -67,7 +68,7 @@ public:
     /// \param color Number containing the RGBA components (in that order)
     ///
     ////////////////////////////////////////////////////////////
-    explicit iColor(Uint32 color);
+    constexpr explicit iColor(Uint32 color);
 
     ////////////////////////////////////////////////////////////
     /// \brief Retrieve the color as a 32-bit unsigned integer
@@ -75,7 +76,7 @@ public:
     /// \return iColor represented as a 32-bit unsigned integer
     ///
     ////////////////////////////////////////////////////////////
-    Uint32 toInteger() const;
+    constexpr Uint32 toInteger() const;
 
     ////////////////////////////////////////////////////////////
     // Static member data
@@ -111,7 +112,7 @@ public:
 /// \return True if colors are equal, false if they are different
 ///
 ////////////////////////////////////////////////////////////
- bool operator ==(const iColor& left, const iColor& right);
+constexpr bool operator ==(const iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -125,7 +126,7 @@ public:
 /// \return True if colors are different, false if they are equal
 ///
 ////////////////////////////////////////////////////////////
- bool operator !=(const iColor& left, const iColor& right);
+constexpr bool operator !=(const iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -140,7 +141,7 @@ public:
 /// \return Result of \a left + \a right
 ///
 ////////////////////////////////////////////////////////////
- iColor operator +(const iColor& left, const iColor& right);
+constexpr iColor operator +(const iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -155,7 +156,7 @@ public:
 /// \return Result of \a left - \a right
 ///
 ////////////////////////////////////////////////////////////
- iColor operator -(const iColor& left, const iColor& right);
+constexpr iColor operator -(const iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -172,7 +173,7 @@ public:
 /// \return Result of \a left * \a right
 ///
 ////////////////////////////////////////////////////////////
- iColor operator *(const iColor& left, const iColor& right);
+constexpr iColor operator *(const iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -188,7 +189,7 @@ public:
 /// \return Reference to \a left
 ///
 ////////////////////////////////////////////////////////////
- iColor& operator +=(iColor& left, const iColor& right);
+constexpr iColor& operator +=(iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -204,7 +205,7 @@ public:
 /// \return Reference to \a left
 ///
 ////////////////////////////////////////////////////////////
- iColor& operator -=(iColor& left, const iColor& right);
+constexpr iColor& operator -=(iColor& left, const iColor& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iColor
@@ -222,7 +223,9 @@ public:
 /// \return Reference to \a left
 ///
 ////////////////////////////////////////////////////////////
- iColor& operator *=(iColor& left, const iColor& right);
+constexpr iColor& operator *=(iColor& left, const iColor& right);
+
+#include "Color.inl"
 
 } // namespace sf
 
@@ -22,31 +22,9 @@
 //
 ////////////////////////////////////////////////////////////
 
-////////////////////////////////////////////////////////////
-// Headers
-////////////////////////////////////////////////////////////
-#include "Color.hpp"
-#include <algorithm>
 
-
-namespace sf
-{
 ////////////////////////////////////////////////////////////
-// Static member data
-////////////////////////////////////////////////////////////
-const iColor iColor::Black(0, 0, 0);
-const iColor iColor::White(255, 255, 255);
-const iColor iColor::Red(255, 0, 0);
-const iColor iColor::Green(0, 255, 0);
-const iColor iColor::Blue(0, 0, 255);
-const iColor iColor::Yellow(255, 255, 0);
-const iColor iColor::Magenta(255, 0, 255);
-const iColor iColor::Cyan(0, 255, 255);
-const iColor iColor::Transparent(0, 0, 0, 0);
-
-
-////////////////////////////////////////////////////////////
-iColor::iColor() :
+constexpr iColor::iColor() :
 r(0),
 g(0),
 b(0),
@@ -57,7 +35,7 @@ a(255)
 
 
 ////////////////////////////////////////////////////////////
-iColor::iColor(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha) :
+constexpr iColor::iColor(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha) :
 r(red),
 g(green),
 b(blue),
@@ -68,7 +46,7 @@ a(alpha)
 
 
 ////////////////////////////////////////////////////////////
-iColor::iColor(Uint32 color) :
+constexpr iColor::iColor(Uint32 color) :
 r((color & 0xff000000) >> 24),
 g((color & 0x00ff0000) >> 16),
 b((color & 0x0000ff00) >> 8 ),
@@ -79,14 +57,14 @@ a((color & 0x000000ff) >> 0 )
 
 
 ////////////////////////////////////////////////////////////
-Uint32 iColor::toInteger() const
+constexpr Uint32 iColor::toInteger() const
 {
     return (r << 24) | (g << 16) | (b << 8) | a;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool operator ==(const iColor& left, const iColor& right)
+constexpr bool operator ==(const iColor& left, const iColor& right)
 {
     return (left.r == right.r) &&
            (left.g == right.g) &&
@@ -96,14 +74,14 @@ bool operator ==(const iColor& left, const iColor& right)
 
 
 ////////////////////////////////////////////////////////////
-bool operator !=(const iColor& left, const iColor& right)
+constexpr bool operator !=(const iColor& left, const iColor& right)
 {
     return !(left == right);
 }
 
 
 ////////////////////////////////////////////////////////////
-iColor operator +(const iColor& left, const iColor& right)
+constexpr iColor operator +(const iColor& left, const iColor& right)
 {
     return iColor(Uint8(std::min(int(left.r) + right.r, 255)),
                  Uint8(std::min(int(left.g) + right.g, 255)),
@@ -113,7 +91,7 @@ iColor operator +(const iColor& left, const iColor& right)
 
 
 ////////////////////////////////////////////////////////////
-iColor operator -(const iColor& left, const iColor& right)
+constexpr iColor operator -(const iColor& left, const iColor& right)
 {
     return iColor(Uint8(std::max(int(left.r) - right.r, 0)),
                  Uint8(std::max(int(left.g) - right.g, 0)),
@@ -123,7 +101,7 @@ iColor operator -(const iColor& left, const iColor& right)
 
 
 ////////////////////////////////////////////////////////////
-iColor operator *(const iColor& left, const iColor& right)
+constexpr iColor operator *(const iColor& left, const iColor& right)
 {
     return iColor(Uint8(int(left.r) * right.r / 255),
                  Uint8(int(left.g) * right.g / 255),
@@ -133,23 +111,35 @@ iColor operator *(const iColor& left, const iColor& right)
 
 
 ////////////////////////////////////////////////////////////
-iColor& operator +=(iColor& left, const iColor& right)
+constexpr iColor& operator +=(iColor& left, const iColor& right)
 {
     return left = left + right;
 }
 
 
 ////////////////////////////////////////////////////////////
-iColor& operator -=(iColor& left, const iColor& right)
+constexpr iColor& operator -=(iColor& left, const iColor& right)
 {
     return left = left - right;
 }
 
 
 ////////////////////////////////////////////////////////////
-iColor& operator *=(iColor& left, const iColor& right)
+constexpr iColor& operator *=(iColor& left, const iColor& right)
 {
     return left = left * right;
 }
 
-} // namespace sf
+
+////////////////////////////////////////////////////////////
+// Static member data
+////////////////////////////////////////////////////////////
+inline constexpr iColor iColor::Black(0, 0, 0);
+inline constexpr iColor iColor::White(255, 255, 255);
+inline constexpr iColor iColor::Red(255, 0, 0);
+inline constexpr iColor iColor::Green(0, 255, 0);
+inline constexpr iColor iColor::Blue(0, 0, 255);
+inline constexpr iColor iColor::Yellow(255, 255, 0);
+inline constexpr iColor iColor::Magenta(255, 0, 255);
+inline constexpr iColor iColor::Cyan(0, 255, 255);
+inline constexpr iColor iColor::Transparent(0, 0, 0, 0);
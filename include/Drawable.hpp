@@ -29,12 +29,12 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
-
+#include "RenderStates.hpp"
 
 
 namespace sf
 {
-
+class RenderTarget;
 
 ////////////////////////////////////////////////////////////
 /// \brief Abstract base class for objects that can be drawn
@@ -51,9 +51,9 @@ public:
     ////////////////////////////////////////////////////////////
     virtual ~Drawable() {}
 
+protected:
 
-
-
+    friend class RenderTarget;
 
     ////////////////////////////////////////////////////////////
     /// \brief Draw the object to a render target
@@ -66,8 +66,7 @@ public:
     /// \param states Current render states
     ///
     ////////////////////////////////////////////////////////////
-    virtual void draw() const = 0;
-
+    virtual void draw(RenderTarget& target, RenderStates states) const = 0;
 };
 
 } // namespace sf
@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_HEADLESSRENDERTARGET_HPP
+#define SFML_HEADLESSRENDERTARGET_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "RenderTarget.hpp"
+#include "SpriteInstance.hpp"
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target recording everything drawn to it
+///        in memory, without any GPU
+///
+////////////////////////////////////////////////////////////
+class  HeadlessRenderTarget : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Description of a recorded draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DrawCall
+    {
+        PrimitiveType type;          ///< Type of primitives drawn
+        std::size_t   firstVertex;   ///< Index of the first vertex in the recorded vertex stream
+        std::size_t   vertexCount;   ///< Number of vertices drawn
+        unsigned int  texture;       ///< Identifier of the texture used, 0 for none
+        BlendMode     blendMode;     ///< Blending mode used
+        bool          buffered;      ///< Whether the vertices came from a vertex buffer
+        std::size_t   firstInstance; ///< Index of the first instance in the recorded instance stream
+        std::size_t   instanceCount; ///< Number of instances drawn, 0 if the draw call is not instanced
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Description of a recorded state change
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StateChange
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Kinds of state changes
+        ///
+        ////////////////////////////////////////////////////////////
+        enum Type
+        {
+            TextureChange,   ///< A different texture was bound
+            TransformChange, ///< A different transform was applied
+            BlendModeChange, ///< A different blending mode was applied
+            ViewChange       ///< A different view was applied
+        };
+
+        Type        type;     ///< Kind of state change
+        std::size_t drawCall; ///< Index of the first draw call using the new state
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Description of a recorded vertex buffer upload
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Upload
+    {
+        const VertexBuffer* buffer;      ///< Vertex buffer that was uploaded
+        std::size_t         offset;      ///< Index of the first uploaded vertex
+        std::size_t         vertexCount; ///< Number of uploaded vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the target
+    ///
+    /// Nothing is rendered, but the size defines the default
+    /// view, which culls the objects drawn outside of it.
+    ///
+    /// \param width  Width of the target, in pixels
+    /// \param height Height of the target, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    HeadlessRenderTarget(unsigned int width = 800, unsigned int height = 600);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region of the target
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual iVector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard everything recorded so far
+    ///
+    /// The target still remembers the vertex buffers it has seen,
+    /// so an unchanged buffer is not uploaded again afterwards.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the recorded vertex stream
+    ///
+    /// Positions are transformed by the transform of the render
+    /// states they were drawn with, except for the quads of
+    /// instanced draw calls, which are kept in local coordinates;
+    /// texture coordinates are kept in pixels.
+    ///
+    /// \return Vertices of every draw call, in drawing order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Vertex>& getVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the recorded draw calls
+    ///
+    /// \return Draw calls, in drawing order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<DrawCall>& getDrawCalls() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the recorded state changes
+    ///
+    /// \return State changes, in drawing order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<StateChange>& getStateChanges() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the recorded vertex buffer uploads
+    ///
+    /// \return Uploads, in drawing order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<Upload>& getUploads() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the recorded sprite instances
+    ///
+    /// \return Instances of every instanced draw call, in drawing order
+    ///
+    ////////////////////////////////////////////////////////////
+    const std::vector<SpriteInstance>& getInstances() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames displayed so far
+    ///
+    /// \return Number of calls to display since the last clear
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getFrameCount() const;
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count the displayed frame
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a view change before the next draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onViewChanged();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw call
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the upload of a vertex buffer and its draw call
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record an instanced draw call and its instances
+    ///
+    /// \param quad          The 4 vertices of the quad, in local coordinates
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                               std::size_t instanceCount, const RenderStates& states);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw call and the state changes it implies
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param buffered    Whether the vertices come from a vertex buffer
+    /// \param instanced   Whether the vertices are a quad drawn once per instance
+    ///
+    ////////////////////////////////////////////////////////////
+    void record(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type,
+                const RenderStates& states, bool buffered, bool instanced);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    iVector2u                             m_size;            ///< Size of the target
+    std::vector<Vertex>                   m_vertices;        ///< Recorded vertex stream
+    std::vector<DrawCall>                 m_drawCalls;       ///< Recorded draw calls
+    std::vector<StateChange>              m_stateChanges;    ///< Recorded state changes
+    std::vector<Upload>                   m_uploads;         ///< Recorded vertex buffer uploads
+    std::map<const VertexBuffer*, Uint64> m_bufferRevisions; ///< Revision of every vertex buffer as of its last upload
+    std::vector<SpriteInstance>           m_instances;       ///< Recorded sprite instances
+    std::size_t                           m_frameCount;      ///< Number of frames displayed
+    bool                                  m_hasState;        ///< Whether a draw call was recorded since the last clear
+    bool                                  m_viewChanged;     ///< Whether the view changed since the last draw call
+    unsigned int                          m_texture;         ///< Texture of the last draw call
+    Transform                             m_transform;       ///< Transform of the last draw call
+    BlendMode                             m_blendMode;       ///< Blending mode of the last draw call
+};
+
+} // namespace sf
+
+
+#endif // SFML_HEADLESSRENDERTARGET_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::HeadlessRenderTarget
+/// \ingroup graphics
+///
+/// sf::HeadlessRenderTarget doesn't render anything: it records
+/// what a GPU backend would be asked to do. This makes it
+/// possible to check or benchmark the rendering code on machines
+/// without a GPU or a window.
+///
+/// Three streams are recorded:
+/// \li the vertices, transformed as the GPU would see them (by
+///     the render states, in world coordinates: the view is
+///     applied as a projection)
+/// \li the draw calls, with their primitive type, texture and blend mode
+/// \li the state changes between consecutive draw calls
+///
+/// An instanced draw (see sf::RenderTarget::drawInstanced) is
+/// recorded as it would reach the GPU: a single draw call whose
+/// four vertices are the quad in local coordinates, and whose
+/// instances are recorded in a stream of their own, so that
+/// tests can check how many instances a frame submitted.
+///
+/// Drawing a sf::VertexBuffer also records the range of vertices
+/// that would be uploaded to the GPU: the whole buffer the first
+/// time, then only the vertices modified since the target last
+/// drew it. The target remembers the revision of every buffer it
+/// has drawn, without touching the range pending for the GPU, so
+/// the same buffer can also be drawn to a GPU target.
+///
+/// In the sf::RenderStats of the target, texture binds, blend
+/// mode changes and view changes are the recorded state changes,
+/// and every draw with a transform other than the identity counts
+/// as a matrix push.
+///
+/// Usage example:
+/// \code
+/// sf::HeadlessRenderTarget target;
+///
+/// target.draw(sprite);
+/// target.draw(shape);
+/// target.display();
+///
+/// assert(target.getDrawCalls().size() == 2);
+/// assert(target.getDrawCalls()[0].vertexCount == 4);
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::RlglRenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PARTICLESYSTEM_HPP
+#define SFML_PARTICLESYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Drawable.hpp"
+#include "Transformable.hpp"
+#include "NonCopyable.hpp"
+#include "PrimitiveType.hpp"
+#include "Vertex.hpp"
+#include "Time.hpp"
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+    class ThreadPool;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Fixed-size set of particles spawned from an
+///        emitter, fading out over their lifetime
+///
+////////////////////////////////////////////////////////////
+class  ParticleSystem : public Drawable, public Transformable, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the particles
+    ///
+    /// Every particle starts dead, and is spawned at the emitter
+    /// on the first update.
+    ///
+    /// \param count       Number of particles
+    /// \param type        Primitive drawn for every particle: sf::Points
+    ///                    for one-pixel particles, sf::Quads for squares
+    ///                    of the particle size
+    /// \param threadCount Number of threads updating the particles,
+    ///                    0 to share the threads of the library, one
+    ///                    per hardware core
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ParticleSystem(std::size_t count, PrimitiveType type = Points, unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position where particles are spawned
+    ///
+    /// \param position Position of the emitter, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEmitter(const iVector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position where particles are spawned
+    ///
+    /// \return Position of the emitter, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    const iVector2f& getEmitter() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the range of the lifetime of new particles
+    ///
+    /// The opacity of a particle is proportional to its remaining
+    /// lifetime, relative to the maximum.
+    ///
+    /// \param minimum Shortest lifetime
+    /// \param maximum Longest lifetime
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLifetime(Time minimum, Time maximum);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the range of the speed of new particles
+    ///
+    /// Particles are emitted in a random direction.
+    ///
+    /// \param minimum Lowest speed, in units per second
+    /// \param maximum Highest speed, in units per second
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSpeed(float minimum, float maximum);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of the particles
+    ///
+    /// The alpha component of the color is replaced by the
+    /// fading opacity of every particle.
+    ///
+    /// \param color New color of the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(const iColor& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the particles drawn as quads
+    ///
+    /// \param size Width and height of a particle, in local units
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParticleSize(float size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of particles
+    ///
+    /// \return Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the particles
+    ///
+    /// Particles move by their velocity, fade, and are spawned
+    /// again at the emitter when their lifetime is over. The
+    /// vertices to draw are written on the way.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance a chunk of particles and write their vertices
+    ///
+    /// \param chunk   Index of the chunk
+    /// \param seconds Time elapsed since the last update, in seconds
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(std::size_t chunk, float seconds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a new position, velocity and lifetime to a particle
+    ///
+    /// \param index Index of the particle
+    /// \param state State of the random generator of its chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void respawn(std::size_t index, Uint32& state);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<float>  m_positionsX;   ///< Horizontal positions of the particles
+    std::vector<float>  m_positionsY;   ///< Vertical positions of the particles
+    std::vector<float>  m_velocitiesX;  ///< Horizontal velocities of the particles
+    std::vector<float>  m_velocitiesY;  ///< Vertical velocities of the particles
+    std::vector<float>  m_lifetimes;    ///< Remaining lifetimes of the particles, in seconds
+    std::vector<Uint32> m_randomStates; ///< State of the random generator of every chunk
+    std::vector<Vertex> m_vertices;     ///< Vertices of the particles, ready to be drawn
+    PrimitiveType       m_type;         ///< Primitive drawn for every particle
+    iVector2f           m_emitter;      ///< Spawning position
+    float               m_minLifetime;  ///< Shortest lifetime of new particles, in seconds
+    float               m_maxLifetime;  ///< Longest lifetime of new particles, in seconds
+    float               m_minSpeed;     ///< Lowest speed of new particles
+    float               m_maxSpeed;     ///< Highest speed of new particles
+    iColor              m_color;        ///< Color of the particles
+    float               m_size;         ///< Size of the quads
+    priv::ThreadPool*   m_threadPool;   ///< Threads updating the chunks
+};
+
+} // namespace sf
+
+
+#endif // SFML_PARTICLESYSTEM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// sf::ParticleSystem animates a large number of simple
+/// particles: each one is spawned at the emitter with a random
+/// direction, speed and lifetime, moves in a straight line and
+/// fades out until it is spawned again.
+///
+/// The particles are stored as a structure of arrays (one array
+/// per attribute), so that update() moves and fades four of them
+/// at a time with SSE2 when it is available. The particles are
+/// split into chunks updated in parallel; every chunk has its own
+/// xorshift random generator, so the result doesn't depend on the
+/// number of threads. The vertices are written during the update,
+/// and drawn in a single call.
+///
+/// It inherits all the functions from sf::Transformable:
+/// position, rotation, scale, origin.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem particles(100000, sf::Quads);
+/// particles.setParticleSize(3.f);
+/// particles.setColor(sf::iColor(255, 200, 50));
+///
+/// while (!WindowShouldClose())
+/// {
+///     particles.setEmitter(sf::iVector2f(GetMouseX(), GetMouseY()));
+///     particles.update(clock.restart());
+///
+///     target.draw(particles);
+/// }
+/// \endcode
+///
+/// \see sf::VertexArray
+///
+////////////////////////////////////////////////////////////
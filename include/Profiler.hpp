@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PROFILER_HPP
+#define SFML_PROFILER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Config.hpp"
+#include "NonCopyable.hpp"
+#include "Time.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Profile the enclosing scope under the given name
+///
+/// The name must be a string literal. Unless SFML_ENABLE_PROFILER
+/// is defined, the macro expands to nothing and costs nothing.
+///
+////////////////////////////////////////////////////////////
+#ifdef SFML_ENABLE_PROFILER
+
+    #define SFML_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define SFML_PROFILE_CONCAT(a, b)      SFML_PROFILE_CONCAT_IMPL(a, b)
+    #define SFML_PROFILE_SCOPE(name)       sf::ProfileScope SFML_PROFILE_CONCAT(sfProfileScope, __LINE__)(name)
+
+#else
+
+    #define SFML_PROFILE_SCOPE(name)
+
+#endif
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Collect and export the timings of the profiled scopes
+///
+////////////////////////////////////////////////////////////
+class  Profiler
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Timings of one scope during a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ScopeSummary
+    {
+        const char* name;  ///< Name of the scope
+        std::size_t count; ///< Number of times the scope was run
+        Time        total; ///< Total time spent in the scope
+        Time        p50;   ///< Median duration of the scope
+        Time        p99;   ///< 99th percentile of the duration of the scope
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish a frame
+    ///
+    /// Collects the scopes recorded by every thread since the
+    /// last call, computes their summary and appends them to the
+    /// trace. This function must be called from a single thread,
+    /// typically the main one, once per frame.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the summary of the last frame
+    ///
+    /// \return One entry per scope name, the most expensive first
+    ///
+    ////////////////////////////////////////////////////////////
+    static const std::vector<ScopeSummary>& getFrameSummary();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Print the summary of the last frame to the standard output
+    ///
+    ////////////////////////////////////////////////////////////
+    static void printFrameSummary();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the collected trace as Chrome trace events
+    ///
+    /// The file can be opened in chrome://tracing or Perfetto.
+    ///
+    /// \param filename Path of the JSON file to write
+    ///
+    /// \return True if the file was written
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool writeChromeTrace(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the collected trace
+    ///
+    ////////////////////////////////////////////////////////////
+    static void clearTrace();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of scopes that could not be recorded
+    ///
+    /// Scopes are dropped when a thread records more of them
+    /// between two calls to endFrame than its ring buffer can
+    /// hold, or when the trace is full.
+    ///
+    /// \return Number of dropped scopes since the program started
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::size_t getDroppedCount();
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Record the duration of the scope it lives in
+///
+////////////////////////////////////////////////////////////
+class  ProfileScope : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start timing the scope
+    ///
+    /// \param name Name of the scope, must be a string literal
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ProfileScope(const char* name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop timing the scope and record it
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ProfileScope();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const char* m_name;  ///< Name of the scope
+    Int64       m_start; ///< Start of the scope, in microseconds since the profiler started
+};
+
+} // namespace sf
+
+
+#endif // SFML_PROFILER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Profiler
+/// \ingroup system
+///
+/// sf::Profiler measures where the time of a frame goes.
+/// Scopes are marked with the SFML_PROFILE_SCOPE macro, which
+/// creates a sf::ProfileScope timing the enclosing block with
+/// the monotonic clock of sf::Clock.
+///
+/// Every thread writes its scopes into its own fixed-size ring
+/// buffer, without locking; endFrame() drains the buffers of
+/// all the threads. Timings have the microsecond resolution
+/// of sf::Time: a single short scope may measure 0, but the
+/// totals over many calls remain accurate.
+///
+/// The scopes are compiled out unless SFML_ENABLE_PROFILER is
+/// defined: without it, SFML_PROFILE_SCOPE expands to nothing.
+///
+/// Usage example:
+/// \code
+/// void ParticleSystem::update(sf::Time elapsed)
+/// {
+///     SFML_PROFILE_SCOPE("ParticleSystem::update");
+///     ...
+/// }
+///
+/// // at the end of every frame
+/// sf::Profiler::endFrame();
+/// sf::Profiler::printFrameSummary();
+///
+/// // when leaving
+/// sf::Profiler::writeChromeTrace("trace.json");
+/// \endcode
+///
+////////////////////////////////////////////////////////////
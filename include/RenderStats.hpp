@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RENDERSTATS_HPP
+#define SFML_RENDERSTATS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "PrimitiveType.hpp"
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Counters describing the cost of a frame
+///
+////////////////////////////////////////////////////////////
+struct  RenderStats
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of primitive types, for the per-type counters
+    ///
+    ////////////////////////////////////////////////////////////
+    enum {PrimitiveTypeCount = Quads + 1};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Every counter is set to zero.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderStats();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set every counter back to zero
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of primitives drawn
+    ///
+    /// \return Sum of the per-type primitive counters
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPrimitiveCount() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t drawCalls;                      ///< Number of non-empty draws that reached the backend
+    std::size_t vertexCount;                    ///< Number of vertices drawn
+    std::size_t instanceCount;                  ///< Number of sprite instances drawn by instanced draws
+    std::size_t primitives[PrimitiveTypeCount]; ///< Number of primitives drawn, indexed by sf::PrimitiveType
+    std::size_t batchFlushes;                   ///< Number of times the backend flushed its batch
+    std::size_t textureBinds;                   ///< Number of times a different texture was bound
+    std::size_t blendModeChanges;               ///< Number of times a different blend mode was applied
+    std::size_t matrixPushes;                   ///< Number of transforms pushed on the matrix stack
+    std::size_t viewChanges;                    ///< Number of times the backend applied a different view
+    std::size_t culledObjects;                  ///< Number of objects skipped because they were outside the view
+};
+
+} // namespace sf
+
+
+#endif // SFML_RENDERSTATS_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderStats
+/// \ingroup graphics
+///
+/// sf::RenderStats gathers what a frame cost to a render
+/// target. The generic counters (draw calls, vertices,
+/// primitives and culled objects) are filled by sf::RenderTarget
+/// for every drawable; the other ones are filled by the backend, and
+/// stay at zero when they don't apply to it.
+///
+/// An instanced draw counts as a single draw call, whose
+/// vertices and primitives are those of all its instances.
+///
+/// The counters are plain integers incremented on the draw
+/// paths, cheap enough to be left on in release builds.
+///
+/// Usage example:
+/// \code
+/// target.draw(sprite);
+/// target.draw(shape);
+/// target.display();
+///
+/// const sf::RenderStats& stats = target.getFrameStats();
+/// printf("%u draws, %u texture binds, %u flushes\n",
+///        (unsigned)stats.drawCalls, (unsigned)stats.textureBinds, (unsigned)stats.batchFlushes);
+/// \endcode
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
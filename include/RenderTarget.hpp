@@ -0,0 +1,470 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RENDERTARGET_HPP
+#define SFML_RENDERTARGET_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "NonCopyable.hpp"
+#include "RenderStates.hpp"
+#include "PrimitiveType.hpp"
+#include "RenderStats.hpp"
+#include "Vertex.hpp"
+#include "View.hpp"
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+class Drawable;
+class SpriteInstance;
+class VertexBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Base class for all render targets
+///
+////////////////////////////////////////////////////////////
+class  RenderTarget : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~RenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a drawable object to the render target
+    ///
+    /// \param drawable Object to draw
+    /// \param states   Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Drawable& drawable, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount,
+              PrimitiveType type, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many copies of the same textured rectangle
+    ///
+    /// Every instance is a sprite showing \a textureRect, placed
+    /// by the transform of the instance and then by the one of
+    /// \a states, and modulated by the color of the instance.
+    /// The whole array is a single draw call; the instances are
+    /// not culled individually.
+    ///
+    /// \param texture       Texture shared by the instances
+    /// \param textureRect   Part of the texture to draw, in pixels
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing; its texture is ignored
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const Texture2D& texture, const IntRect& textureRect, const SpriteInstance* instances,
+                       std::size_t instanceCount, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current active view
+    ///
+    /// The view defines which part of the 2D world is visible,
+    /// and where it is shown on the target (its viewport); objects
+    /// entirely outside of it are not drawn. The new view will
+    /// affect everything that is drawn, until another view is
+    /// set: moving a camera over a world is a matter of moving
+    /// the view, not the objects. The render target keeps its own copy of the view
+    /// object, so it is not necessary to keep the original one
+    /// alive after calling this function.
+    /// To restore the original view of the target, you can pass
+    /// the result of getDefaultView() to this function.
+    ///
+    /// \param view New view to use
+    ///
+    /// \see getView, getDefaultView
+    ///
+    ////////////////////////////////////////////////////////////
+    void setView(const View& view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the view currently in use in the render target
+    ///
+    /// \return The view object that is currently used
+    ///
+    /// \see setView, getDefaultView
+    ///
+    ////////////////////////////////////////////////////////////
+    const View& getView() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the default view of the render target
+    ///
+    /// The default view has the initial size of the render target,
+    /// and never changes after the target has been created.
+    ///
+    /// \return The default view of the render target
+    ///
+    /// \see setView, getView
+    ///
+    ////////////////////////////////////////////////////////////
+    const View& getDefaultView() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the viewport of a view, applied to this render target
+    ///
+    /// The viewport is defined in the view as a ratio, this function
+    /// simply applies this ratio to the current dimensions of the
+    /// render target to calculate the pixels rectangle that the viewport
+    /// actually covers in the target.
+    ///
+    /// \param view The view for which we want to compute the viewport
+    ///
+    /// \return Viewport rectangle, expressed in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getViewport(const View& view) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a point from target coordinates to world
+    ///        coordinates, using the current view
+    ///
+    /// This function is an overload of the mapPixelToCoords
+    /// function that implicitly uses the current view.
+    ///
+    /// \param point Pixel to convert
+    ///
+    /// \return The converted point, in "world" coordinates
+    ///
+    /// \see mapCoordsToPixel
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f mapPixelToCoords(const iVector2i& point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a point from target coordinates to world coordinates
+    ///
+    /// This function finds the 2D position that matches the
+    /// given pixel of the render target, for instance the
+    /// world position under the mouse cursor. Initially, both
+    /// coordinate systems (world units and target pixels) match
+    /// perfectly; once a custom view is set, they don't anymore.
+    ///
+    /// \param point Pixel to convert
+    /// \param view  The view to use for converting the point
+    ///
+    /// \return The converted point, in "world" units
+    ///
+    /// \see mapCoordsToPixel
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f mapPixelToCoords(const iVector2i& point, const View& view) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a point from world coordinates to target
+    ///        coordinates, using the current view
+    ///
+    /// This function is an overload of the mapCoordsToPixel
+    /// function that implicitly uses the current view.
+    ///
+    /// \param point Point to convert
+    ///
+    /// \return The converted point, in target coordinates (pixels)
+    ///
+    /// \see mapPixelToCoords
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2i mapCoordsToPixel(const iVector2f& point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a point from world coordinates to target coordinates
+    ///
+    /// This function finds the pixel of the render target that
+    /// matches the given 2D point. This is the inverse of
+    /// mapPixelToCoords.
+    ///
+    /// \param point Point to convert
+    /// \param view  The view to use for converting the point
+    ///
+    /// \return The converted point, in target coordinates (pixels)
+    ///
+    /// \see mapPixelToCoords
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2i mapCoordsToPixel(const iVector2f& point, const View& view) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an object lies entirely outside the view
+    ///
+    /// Drawables call this function before submitting their
+    /// vertices, with their bounds transformed by their render
+    /// states. The objects found outside the view are counted in
+    /// the statistics of the frame.
+    ///
+    /// \param bounds Bounding rectangle of the object, in world coordinates
+    ///
+    /// \return True if the object can't be seen and must not be drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    bool cull(const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region of the target
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual iVector2u getSize() const = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish the current frame
+    ///
+    /// Everything that was drawn since the last call is
+    /// flushed to the backend, and the statistics of the frame
+    /// are moved to the history.
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the frame being drawn
+    ///
+    /// \return Counters accumulated since the last call to display
+    ///
+    ////////////////////////////////////////////////////////////
+    const RenderStats& getStats() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of a finished frame
+    ///
+    /// \param framesAgo Age of the frame: 0 for the last displayed
+    ///                  frame, 1 for the one before, and so on;
+    ///                  must be less than getStatsHistorySize()
+    ///
+    /// \return Counters of the frame
+    ///
+    ////////////////////////////////////////////////////////////
+    const RenderStats& getFrameStats(std::size_t framesAgo = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames kept in the statistics history
+    ///
+    /// The history keeps the last 120 frames.
+    ///
+    /// \return Number of frames available to getFrameStats
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getStatsHistorySize() const;
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Performs the common initialization step after creation
+    ///
+    /// The derived classes must call this function once their
+    /// size is known, to set up the default view.
+    ///
+    ////////////////////////////////////////////////////////////
+    void initialize();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the frame being drawn, to update them
+    ///
+    /// Backends use it to count their own events (flushes,
+    /// texture binds, ...).
+    ///
+    /// \return Counters of the current frame
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderStats& getCurrentStats();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called by display to finish the frame
+    ///
+    /// The backend flushes what it has batched. The default
+    /// implementation does nothing.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called by setView when the view changes
+    ///
+    /// The backend applies the new view, once for every drawable
+    /// that follows, instead of combining it with the transform
+    /// of each of them. The default implementation does nothing.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onViewChanged();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices
+    ///
+    /// This function is called by the public draw functions,
+    /// once the vertices are known to be non-empty. It has to
+    /// be implemented by the backend.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                PrimitiveType type, const RenderStates& states) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the content of a vertex buffer
+    ///
+    /// This function is called by the public draw function,
+    /// once the buffer is known to be non-empty. It has to
+    /// upload the pending changes of the buffer, if any.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw copies of a quad, one per instance
+    ///
+    /// This function is called by drawInstanced, once the
+    /// instances are known to be non-empty. The default
+    /// implementation expands the instances into quads on the
+    /// CPU and draws them with drawPrimitives.
+    ///
+    /// \param quad          The 4 vertices of the quad, in local coordinates and in Quads order
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                               std::size_t instanceCount, const RenderStates& states);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    View                     m_defaultView;      ///< Default view
+    View                     m_view;             ///< Current view
+    FloatRect                m_viewBounds;       ///< Area of the world covered by the current view
+    RenderStats              m_stats;            ///< Counters of the frame being drawn
+    std::vector<RenderStats> m_statsHistory;     ///< Counters of the last frames, as a ring buffer
+    std::size_t              m_frameCount;       ///< Number of frames displayed so far
+    std::vector<Vertex>      m_instanceVertices; ///< Quads of the instances expanded on the CPU
+};
+
+} // namespace sf
+
+
+#endif // SFML_RENDERTARGET_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTarget
+/// \ingroup graphics
+///
+/// sf::RenderTarget defines the common behavior of all the
+/// 2D render targets. It makes it possible to draw 2D entities
+/// like sprites, shapes, text without using any rlgl or OpenGL
+/// command directly.
+///
+/// Every drawable ends up as a call to one of the two protected
+/// hooks, drawPrimitives and drawBuffer, which are the only
+/// functions a backend has to implement. Instanced draws go
+/// through a third hook, drawInstances, that backends able to
+/// draw instances on the GPU override. Two backends are
+/// provided:
+/// \li sf::RlglRenderTarget draws through raylib's rlgl layer
+/// \li sf::HeadlessRenderTarget records everything in memory,
+///     for tests and benchmarks running without a GPU
+///
+/// The current sf::View is a single projection shared by every
+/// drawable: backends apply it once when it changes, so scrolling
+/// a world costs one view change per frame, whatever the number of
+/// objects. The viewport of the view restricts drawing to a part
+/// of the target, for split screens or minimaps.
+/// Drawables whose bounds fall entirely outside the current
+/// view are skipped before any vertex is submitted: shapes,
+/// sprites and vertex arrays test their bounds with cull().
+///
+/// Every target counts what its frames cost in a sf::RenderStats:
+/// getStats() returns the frame being drawn, and getFrameStats()
+/// the frames already displayed.
+///
+/// Thousands of copies of the same image (bullets, tiles,
+/// particles) are best drawn with drawInstanced: each copy costs
+/// a packed sf::SpriteInstance instead of four vertices.
+///
+/// Usage example:
+/// \code
+/// sf::RlglRenderTarget target;
+///
+/// BeginDrawing();
+/// ClearBackground(BLACK);
+/// target.draw(sprite);
+/// target.draw(shape, sf::RenderStates(transform));
+///
+/// sf::View minimap(sf::FloatRect(0, 0, 4000, 3000));
+/// minimap.setViewport(sf::FloatRect(0.75f, 0, 0.25f, 0.25f));
+/// target.setView(minimap);
+/// target.draw(world);
+/// target.setView(target.getDefaultView());
+/// target.display();
+/// EndDrawing();
+/// \endcode
+///
+/// \see sf::RlglRenderTarget, sf::HeadlessRenderTarget, sf::Drawable
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,286 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RLGLRENDERTARGET_HPP
+#define SFML_RLGLRENDERTARGET_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "RenderTarget.hpp"
+#include "VertexBuffer.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target drawing through raylib's rlgl layer
+///
+////////////////////////////////////////////////////////////
+class  RlglRenderTarget : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The raylib window must be created before the target,
+    /// whose default view covers the window.
+    ///
+    ////////////////////////////////////////////////////////////
+    RlglRenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Releases the GPU resources of the instanced draws.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RlglRenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region of the target
+    ///
+    /// This is the size of the window, or of the render texture
+    /// between BeginTextureMode() and EndTextureMode().
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual iVector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give rlgl back to raylib and forget the cached states
+    ///
+    /// The target only sends the texture, the blend mode and the
+    /// view to rlgl when they differ from the ones it set last.
+    /// If raylib is used directly between two draws (DrawText,
+    /// BeginTextureMode, ...), this function must be called first:
+    /// it flushes what the target batched, restores raylib's
+    /// projection, viewport and blending, and makes the next draw
+    /// to the target set every state again.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetGLStates();
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish the current frame
+    ///
+    /// Flushes the rlgl batch and restores raylib's states, like
+    /// resetGLStates(), so that EndDrawing() and whatever raylib
+    /// draws next are not affected by the view of the target.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule the new view to be applied on the next draw
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onViewChanged();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the rlgl batch
+    ///
+    /// Large arrays of triangles are copied to a GPU buffer and
+    /// drawn with a single call instead.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a vertex buffer from GPU memory
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw copies of a quad with a single instanced draw call
+    ///
+    /// Falls back to expanding the instances on the CPU when
+    /// the OpenGL version doesn't support instancing.
+    ///
+    /// \param quad          The 4 vertices of the quad, in local coordinates
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                               std::size_t instanceCount, const RenderStates& states);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the current view
+    ///
+    /// The view becomes the rlgl projection matrix, and its
+    /// viewport the rlgl viewport.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyCurrentView();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply a new blending mode
+    ///
+    /// \param mode Blending mode to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyBlendMode(const BlendMode& mode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a texture for the next rlgl primitives
+    ///
+    /// \param textureId Identifier of the texture to bind
+    /// \param primitive rlgl primitive that will be drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyTexture(unsigned int textureId, int primitive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the shader and the buffers of the instanced draws
+    ///
+    /// Only the first call does the work; the following ones
+    /// return its result.
+    ///
+    /// \return True if instanced draws are available
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadInstancing();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render states cache
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StatesCache
+    {
+        enum {VertexCacheSize = 4};
+
+        bool         enable;                      ///< Is the cache enabled?
+        bool         viewChanged;                 ///< Has the current view changed since last draw?
+        Matrix       raylibProjection;            ///< Projection matrix of raylib, restored by resetGLStates
+        Matrix       raylibModelview;             ///< Modelview matrix of raylib, restored by resetGLStates
+        BlendMode    lastBlendMode;               ///< Cached blending mode
+        bool         textureSet;                  ///< Is lastTextureId the texture bound in rlgl?
+        unsigned int lastTextureId;               ///< Cached texture
+        int          lastPrimitive;               ///< rlgl primitive the cached texture was bound for
+        Vertex       vertexCache[VertexCacheSize]; ///< Pre-transformed vertices cache
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief GPU resources of the instanced draws
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instancing
+    {
+        enum {AttributeCount = 6};
+
+        bool         loaded;                     ///< Has loadInstancing been called?
+        unsigned int shader;                     ///< Shader transforming the quad by each instance, 0 if unavailable
+        int          mvpLocation;                ///< Location of the model-view-projection matrix uniform
+        int          textureLocation;            ///< Location of the texture sampler uniform
+        int          attributes[AttributeCount]; ///< Locations of the vertex attributes, then of the instance attributes
+        unsigned int vao;                        ///< Vertex array object binding the quad and the instances
+        unsigned int quadVbo;                    ///< Vertex buffer of the quad, as two triangles
+        unsigned int instanceVbo;                ///< Vertex buffer of the instances
+        std::size_t  capacity;                   ///< Number of instances the instance buffer can hold
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    StatesCache  m_cache;        ///< Render states cache
+    Instancing   m_instancing;   ///< Resources of the instanced draws
+    VertexBuffer m_streamBuffer; ///< GPU buffer the large vertex arrays are copied to
+};
+
+} // namespace sf
+
+
+#endif // SFML_RLGLRENDERTARGET_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RlglRenderTarget
+/// \ingroup graphics
+///
+/// sf::RlglRenderTarget draws into whatever raylib is currently
+/// rendering to: the window between BeginDrawing() and
+/// EndDrawing(), or a render texture between BeginTextureMode()
+/// and EndTextureMode().
+///
+/// Vertices are appended to the rlgl batch, with the transform
+/// of the render states pushed on the rlgl matrix stack and the
+/// texture of the render states bound. Texture coordinates are
+/// given in pixels and normalized by the size of the texture.
+///
+/// The current view replaces raylib's projection matrix, and its
+/// viewport the rlgl viewport; both are set on the first draw
+/// after a call to setView, with a single flush of the batch,
+/// whatever the number of objects drawn under the view. raylib's
+/// own projection and viewport are restored by display() and
+/// resetGLStates().
+///
+/// Redundant states are not sent to rlgl: the texture and the
+/// blend mode are only changed when they differ from the ones of
+/// the previous draw, which spares rlgl a new draw call (or a
+/// flush, for the blend mode) every time. Small drawables such
+/// as sprites are transformed on the CPU, and the identity
+/// transform is not pushed at all, so that the matrix stack is
+/// only touched by large transformed geometry. Because of this
+/// cache, resetGLStates() must be called before using raylib
+/// directly in the middle of a frame, and display() must be
+/// called once per frame, before EndDrawing().
+///
+/// Vertex buffers are drawn from GPU memory with a single draw
+/// call; the rlgl batch is flushed first so that the drawing
+/// order is preserved. Large arrays of triangles, strips, fans
+/// or quads (4096 vertices or more) take the same path: they are
+/// copied to a stream vertex buffer owned by the target, with a
+/// single upload, instead of costing three rlgl calls per vertex
+/// in the batch. Points and lines always go through the batch.
+///
+/// Instanced draws (see sf::RenderTarget::drawInstanced) flush
+/// the batch the same way, then issue a single instanced draw
+/// call: the quad and the packed instances are uploaded to GPU
+/// buffers, and a small shader applies the transform and color
+/// of every instance. This requires OpenGL 3.3; with older
+/// versions, the instances are expanded into quads on the CPU
+/// and batched.
+///
+/// \see sf::RenderTarget, sf::HeadlessRenderTarget
+///
+////////////////////////////////////////////////////////////
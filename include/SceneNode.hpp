@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SCENENODE_HPP
+#define SFML_SCENENODE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Drawable.hpp"
+#include "Transformable.hpp"
+#include "NonCopyable.hpp"
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Transformable node of a hierarchy, positioned
+///        relatively to its parent
+///
+////////////////////////////////////////////////////////////
+class  SceneNode : public Drawable, public Transformable, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a node with no parent and no children.
+    ///
+    ////////////////////////////////////////////////////////////
+    SceneNode();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The node is detached from its parent, and its children
+    /// become roots.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~SceneNode();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a child to the node
+    ///
+    /// The child is detached from its previous parent first. The
+    /// node doesn't take ownership of the child, which must stay
+    /// alive while it is attached, or be destroyed first. The
+    /// child must not be an ancestor of the node.
+    ///
+    /// \param child Node to attach
+    ///
+    ////////////////////////////////////////////////////////////
+    void attachChild(SceneNode& child);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a child from the node
+    ///
+    /// Nothing happens if \a child is not a child of the node.
+    ///
+    /// \param child Node to detach
+    ///
+    ////////////////////////////////////////////////////////////
+    void detachChild(SceneNode& child);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parent of the node
+    ///
+    /// \return Parent node, NULL if the node is a root
+    ///
+    ////////////////////////////////////////////////////////////
+    SceneNode* getParent() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of children of the node
+    ///
+    /// \return Number of children
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getChildCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a child of the node
+    ///
+    /// \param index Index of the child, in [0, getChildCount())
+    ///
+    /// \return Child node, in the order of attachment
+    ///
+    ////////////////////////////////////////////////////////////
+    SceneNode& getChild(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform from the node to the world
+    ///
+    /// This is the transform of the node combined with the ones
+    /// of all its ancestors. It is cached, and only recomputed
+    /// when the node or one of its ancestors has moved since the
+    /// last call.
+    ///
+    /// \return World transform of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    const Transform& getWorldTransform() const;
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the content of the node to a render target
+    ///
+    /// Override this function to draw what the node displays;
+    /// the children are drawn after it. The default
+    /// implementation draws nothing, for nodes that only group
+    /// their children.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Render states, with the world transform of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawCurrent(RenderTarget& target, RenderStates states) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the node and its subtree to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the node and its children
+    ///
+    /// \param target   Render target to draw to
+    /// \param states   Render states given to the root of the draw
+    /// \param identity Whether the transform of \a states is the identity
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawTree(RenderTarget& target, const RenderStates& states, bool identity) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the world transform if the node or its parent moved
+    ///
+    /// The world transform of the parent must be up to date.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateWorldTransform() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SceneNode*              m_parent;           ///< Parent node, NULL for a root
+    std::vector<SceneNode*> m_children;         ///< Child nodes, in the order of attachment
+    mutable Transform       m_worldTransform;   ///< Transform from the node to the world
+    mutable bool            m_worldNeedUpdate;  ///< Must the world transform be recomputed regardless of the revisions?
+    mutable Uint32          m_localRevision;    ///< Transform revision of the node when the world transform was computed
+    mutable Uint32          m_parentRevision;   ///< World revision of the parent when the world transform was computed
+    mutable Uint32          m_worldRevision;    ///< Incremented every time the world transform is recomputed
+};
+
+} // namespace sf
+
+
+#endif // SFML_SCENENODE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SceneNode
+/// \ingroup graphics
+///
+/// sf::SceneNode builds hierarchies of objects, such as turrets
+/// on tanks or widgets in panels: the position, rotation, scale
+/// and origin of a node, inherited from sf::Transformable, are
+/// relative to its parent.
+///
+/// Every node caches its world transform, along with the
+/// transform revision of the node and the world revision of its
+/// parent it was computed from. When a node moves, only its
+/// subtree sees a new revision: the world transforms of the
+/// other nodes are reused as they are, and a transform is only
+/// combined with the one of its parent when one of them changed.
+///
+/// Drawing a node draws its whole subtree, each node with its
+/// world transform. Derived classes override drawCurrent to
+/// draw their content.
+///
+/// Usage example:
+/// \code
+/// class SpriteNode : public sf::SceneNode
+/// {
+/// public:
+///
+///     sf::Sprite sprite;
+///
+/// private:
+///
+///     virtual void drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+///     {
+///         target.draw(sprite, states);
+///     }
+/// };
+///
+/// SpriteNode tank;
+/// SpriteNode turret;
+/// tank.attachChild(turret);
+/// turret.setPosition(16, 8);
+///
+/// tank.move(1, 0);      // the turret follows the tank
+/// turret.rotate(5);     // the tank is not affected
+/// target.draw(tank);    // draws the tank, then the turret
+/// \endcode
+///
+/// \see sf::Transformable, sf::Transform
+///
+////////////////////////////////////////////////////////////
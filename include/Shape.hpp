@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
+#include "CacheState.hpp"
 #include "Drawable.hpp"
 #include "Transformable.hpp"
 #include "VertexArray.hpp"
@@ -251,11 +252,27 @@ public:
     ///
     /// This function must be called by the derived class everytime
     /// the shape's points change (i.e. the result of either
-    /// getPointCount or getPoint is different).
+    /// getPointCount or getPoint is different). It only marks the
+    /// geometry as outdated: it is rebuilt once, the next time the
+    /// shape is drawn or its bounds are requested, however many
+    /// times this function was called in between.
     ///
     ////////////////////////////////////////////////////////////
     void update();
 
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Shape();
+
+
+
+private:
+
+    friend class SpriteBatch;
 
     ////////////////////////////////////////////////////////////
     /// \brief Draw the shape to a render target
@@ -264,60 +281,72 @@ public:
     /// \param states Current render states
     ///
     ////////////////////////////////////////////////////////////
-    virtual void draw() const;
-
-protected:
+    virtual void draw(RenderTarget& target, RenderStates states) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Default constructor
+    /// \brief Rebuild the parts of the vertices that are outdated
+    ///
+    /// The triangle lists that are drawn are refreshed as well,
+    /// when the fill or the outline changed. Several threads may
+    /// call this function at once, as long as none of them
+    /// modifies the shape.
     ///
     ////////////////////////////////////////////////////////////
-    Shape();
-
-
-
-private:
+    void updateIfNeeded() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position and the inside bounds
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateFillColors();
+    void updateFillColors() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateTexCoords();
+    void updateTexCoords() const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Update the outline vertices' position
+    /// \brief Update the outline vertices' position and color, and the bounds
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
  //   ////////////////////////////////////////////////////////////
-     Texture2D m_texture;          ///< Texture of the shape
-    IntRect        m_textureRect;      ///< Rectangle defining the area of the source texture to display
-    iColor          m_fillColor;        ///< Fill color
-    iColor          m_outlineColor;     ///< Outline color
-    float          m_outlineThickness; ///< Thickness of the shape's outline
-    VertexArray    m_vertices;         ///< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices;  ///< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;     ///< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
-    bool           m_useTexture;
+    Texture2D           m_texture;                 ///< Texture of the shape
+    IntRect             m_textureRect;             ///< Rectangle defining the area of the source texture to display
+    iColor              m_fillColor;               ///< Fill color
+    iColor              m_outlineColor;            ///< Outline color
+    float               m_outlineThickness;        ///< Thickness of the shape's outline
+    mutable VertexArray m_vertices;                ///< Vertex array containing the fill geometry
+    mutable VertexArray m_outlineVertices;         ///< Vertex array containing the outline geometry
+    mutable FloatRect   m_insideBounds;            ///< Bounding rectangle of the inside (fill)
+    mutable FloatRect   m_bounds;                  ///< Bounding rectangle of the whole shape (outline + fill)
+    mutable VertexArray m_fillTriangles;           ///< Fill geometry as independent triangles, as it is drawn
+    mutable VertexArray m_outlineTriangles;        ///< Outline geometry as independent triangles, as it is drawn
+    bool                m_useTexture;
+    mutable bool        m_geometryNeedUpdate;      ///< Do the points need to be fetched again?
+    mutable bool        m_fillColorsNeedUpdate;    ///< Does the fill color need to be applied to the vertices?
+    mutable bool        m_texCoordsNeedUpdate;     ///< Do the texture coordinates need to be recomputed?
+    mutable bool        m_outlineNeedUpdate;       ///< Does the outline need to be rebuilt?
+    mutable bool        m_outlineColorsNeedUpdate; ///< Does the outline color need to be applied to the vertices?
+    priv::CacheState    m_verticesState;           ///< Are the vertices, bounds and triangle lists up to date?
 };
 
 } // namespace sf
@@ -354,6 +383,15 @@ private:
 /// \li getPointCount must return the number of points of the shape
 /// \li getPoint must return the points of the shape
 ///
+/// The vertices are rebuilt lazily: the setters only record
+/// what is outdated, and the next call to draw, getLocalBounds
+/// or getGlobalBounds rebuilds it once, as little as needed (a
+/// new fill color doesn't move any vertex, a new outline
+/// thickness doesn't touch the fill). The fill and the outline
+/// are then kept as lists of independent triangles, so that
+/// drawing a shape submits them as they are, without converting
+/// the fan and the strip again on every frame.
+///
 /// \see sf::RectangleShape, sf::CircleShape, sf::ConvexShape, sf::Transformable
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOFTWARERENDERTARGET_HPP
+#define SFML_SOFTWARERENDERTARGET_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "RenderTarget.hpp"
+#include "Time.hpp"
+#include "Vector2.hpp"
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+    class ThreadPool;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Render target rasterizing on the CPU into an
+///        RGBA pixel buffer
+///
+////////////////////////////////////////////////////////////
+class  SoftwareRenderTarget : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the last rendered frame
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t triangleCount;      ///< Number of triangles rasterized
+        Uint64      pixelCount;         ///< Number of pixels written
+        Time        renderTime;         ///< Time spent binning and rasterizing
+        float       pixelsPerSecond;    ///< Pixel throughput
+        float       trianglesPerSecond; ///< Triangle throughput
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the target and its pixel buffer
+    ///
+    /// \param width       Width of the target, in pixels
+    /// \param height      Height of the target, in pixels
+    /// \param threadCount Number of threads rasterizing the frames,
+    ///                    0 to share the threads of the library, one
+    ///                    per hardware core
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTarget(unsigned int width, unsigned int height, unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoftwareRenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region of the target
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual iVector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the entire target with a single color
+    ///
+    /// Everything drawn since the last call to display is
+    /// discarded.
+    ///
+    /// \param color Fill color to use to clear the render target
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear(const iColor& color = iColor(0, 0, 0, 255));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide the pixels of a texture
+    ///
+    /// Textures live in GPU memory, which the software target
+    /// can't read. This function gives it a CPU-side copy of
+    /// the pixels to sample when drawing with \a texture.
+    /// Geometry drawn with a texture that was not registered
+    /// is drawn untextured.
+    ///
+    /// \param texture Texture, identified by its id
+    /// \param image   Pixels of the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void registerTexture(const Texture2D& texture, const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the pixels of a texture
+    ///
+    /// \param texture Texture to unregister
+    ///
+    ////////////////////////////////////////////////////////////
+    void unregisterTexture(const Texture2D& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pixels of the target
+    ///
+    /// The buffer holds getSize().x * getSize().y RGBA pixels,
+    /// row by row from the top, as of the last call to display.
+    ///
+    /// \return Pointer to the pixel buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    const Uint8* getPixels() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the last call to display
+    ///
+    /// \return Statistics of the last rendered frame
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize everything drawn since the last call
+    ///
+    /// The triangles are binned into screen tiles, and the tiles
+    /// are rasterized in parallel. Drawing order is preserved
+    /// within every pixel.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the mapping from world coordinates to pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onViewChanged();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives for rasterization
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the content of a vertex buffer for rasterization
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief CPU-side copy of a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TextureData
+    {
+        unsigned int       width;  ///< Width of the image, in pixels
+        unsigned int       height; ///< Height of the image, in pixels
+        std::vector<Uint8> pixels; ///< RGBA pixels of the image
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Triangle ready to be rasterized
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Triangle
+    {
+        Vertex             vertices[3]; ///< Vertices, in target coordinates and with a positive area
+        float              edges[3][3]; ///< Edge functions (a, b, c) of the edges opposite to each vertex
+        float              invArea;     ///< Inverse of the doubled area of the triangle
+        int                left;        ///< Left of the bounding box, in pixels
+        int                top;         ///< Top of the bounding box, in pixels
+        int                right;       ///< Right of the bounding box, in pixels (exclusive)
+        int                bottom;      ///< Bottom of the bounding box, in pixels (exclusive)
+        const TextureData* texture;     ///< Texture to sample, NULL for none
+        BlendMode          blendMode;   ///< Blending mode of the pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a triangle
+    ///
+    /// \param a         First vertex, in local coordinates
+    /// \param b         Second vertex, in local coordinates
+    /// \param c         Third vertex, in local coordinates
+    /// \param transform Transform from local to target coordinates
+    /// \param texture   Texture to sample, NULL for none
+    /// \param blendMode Blending mode of the pixels
+    ///
+    /// The triangle is clipped to the viewport of the current view.
+    ///
+    ////////////////////////////////////////////////////////////
+    void addTriangle(const Vertex& a, const Vertex& b, const Vertex& c, const Transform& transform,
+                     const TextureData* texture, const BlendMode& blendMode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a one-pixel wide line, as two triangles
+    ///
+    /// \param a         First end, in local coordinates
+    /// \param b         Second end, in local coordinates
+    /// \param transform Transform from local to target coordinates
+    /// \param texture   Texture to sample, NULL for none
+    /// \param blendMode Blending mode of the pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void addLine(const Vertex& a, const Vertex& b, const Transform& transform,
+                 const TextureData* texture, const BlendMode& blendMode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort a range of the queued triangles into the tiles they cover
+    ///
+    /// \param chunk Index of the range
+    ///
+    ////////////////////////////////////////////////////////////
+    void binTriangles(std::size_t chunk);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the triangles covering a tile
+    ///
+    /// \param tile Index of the tile
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterizeTile(std::size_t tile);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int                                m_width;      ///< Width of the target, in pixels
+    unsigned int                                m_height;     ///< Height of the target, in pixels
+    unsigned int                                m_tilesX;     ///< Number of tile columns
+    unsigned int                                m_tilesY;     ///< Number of tile rows
+    std::vector<Uint8>                          m_pixels;     ///< RGBA pixel buffer
+    Transform                                   m_viewTransform; ///< Transform from world coordinates to pixels
+    IntRect                                     m_viewport;   ///< Pixels covered by the viewport of the current view
+    std::map<unsigned int, TextureData>         m_textures;   ///< Registered textures, by identifier
+    std::vector<Triangle>                       m_triangles;  ///< Triangles queued since the last display
+    std::vector<std::vector<std::vector<Uint32> > > m_bins; ///< Triangle indices, per chunk of triangles and per tile
+    std::vector<Uint64>                         m_tilePixels; ///< Pixels written in each tile during the last display
+    priv::ThreadPool*                           m_threadPool; ///< Threads binning and rasterizing the frames
+    Statistics                                  m_statistics; ///< Counters of the last display
+};
+
+} // namespace sf
+
+
+#endif // SFML_SOFTWARERENDERTARGET_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoftwareRenderTarget
+/// \ingroup graphics
+///
+/// sf::SoftwareRenderTarget renders on the CPU, without a GPU
+/// or a window. It is meant for servers producing thumbnails,
+/// replays or reference images.
+///
+/// Drawing only queues triangles: lines and points are turned
+/// into one-pixel wide quads, and every vertex is transformed
+/// by the render states, then by the current view to the pixels
+/// of its viewport, outside of which nothing is drawn. When
+/// display() is called, the triangles are sorted into 64x64
+/// tiles in parallel, and the tiles are rasterized in parallel
+/// as well, with edge functions evaluated four pixels at a time
+/// with SSE2 when it is available. Pixels are blended in drawing order, with the
+/// blend mode of the render states; the default alpha blending
+/// has a faster path than the other modes.
+///
+/// Textures are sampled with nearest filtering from the images
+/// given to registerTexture; texture coordinates are in pixels,
+/// as for the other render targets.
+///
+/// Usage example:
+/// \code
+/// sf::SoftwareRenderTarget target(800, 600);
+/// target.registerTexture(texture, image);
+///
+/// target.clear(sf::iColor(100, 200, 100));
+/// target.draw(sprite);
+/// target.draw(shape);
+/// target.display();
+///
+/// Image frame = {(void*)target.getPixels(), 800, 600, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+/// ExportImage(frame, "frame.png");
+///
+/// const sf::SoftwareRenderTarget::Statistics& stats = target.getStatistics();
+/// printf("%.1f Mpixels/s\n", stats.pixelsPerSecond / 1000000.f);
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::RlglRenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SPATIALINDEX_HPP
+#define SFML_SPATIALINDEX_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Rect.hpp"
+#include "Vector2.hpp"
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Dynamic bounding volume tree over rectangles,
+///        for culling, picking and proximity queries
+///
+////////////////////////////////////////////////////////////
+class  SpatialIndex
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an invalid entry
+    ///
+    ////////////////////////////////////////////////////////////
+    enum {NullEntry = -1};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty index
+    ///
+    /// \param margin Distance by which the bounds of every entry
+    ///               are enlarged, so that objects moving by less
+    ///               than this don't have to be moved in the tree
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialIndex(float margin = 8.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an entry to the index
+    ///
+    /// \param bounds   Bounding rectangle of the entry, usually
+    ///                 the global bounds of a drawable
+    /// \param userData Pointer returned by the queries for this
+    ///                 entry, usually the drawable itself
+    ///
+    /// \return Identifier of the new entry
+    ///
+    ////////////////////////////////////////////////////////////
+    int insert(const FloatRect& bounds, void* userData);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an entry from the index
+    ///
+    /// \param entry Identifier of the entry, as returned by insert
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(int entry);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounds of an entry
+    ///
+    /// This is cheap when the new bounds are still inside the
+    /// enlarged bounds stored for the entry: nothing is done
+    /// in this case. Otherwise the entry is moved in the tree.
+    ///
+    /// \param entry  Identifier of the entry, as returned by insert
+    /// \param bounds New bounding rectangle of the entry
+    ///
+    /// \return True if the entry was moved in the tree
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(int entry, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove every entry
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pointer given when an entry was inserted
+    ///
+    /// \param entry Identifier of the entry
+    ///
+    /// \return User data of the entry
+    ///
+    ////////////////////////////////////////////////////////////
+    void* getUserData(int entry) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the enlarged bounds stored for an entry
+    ///
+    /// \param entry Identifier of the entry
+    ///
+    /// \return Bounds of the entry, enlarged by the margin
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getFatBounds(int entry) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries
+    ///
+    /// \return Number of entries in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getEntryCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the height of the tree
+    ///
+    /// The tree is kept balanced, so its height grows with the
+    /// logarithm of the number of entries.
+    ///
+    /// \return Height of the tree, 0 when it is empty or has a single entry
+    ///
+    ////////////////////////////////////////////////////////////
+    int getHeight() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the entries overlapping a rectangle
+    ///
+    /// Entries are tested with their enlarged bounds, so an
+    /// entry can be reported while its exact bounds are up to
+    /// the margin away from the rectangle. Touching rectangles
+    /// overlap, as for sf::RenderTarget::cull.
+    ///
+    /// \param area    Rectangle to test
+    /// \param results Vector the user data of the entries is appended to
+    ///
+    /// \return Number of entries found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const FloatRect& area, std::vector<void*>& results) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the entries containing a point
+    ///
+    /// \param point   Point to test
+    /// \param results Vector the user data of the entries is appended to
+    ///
+    /// \return Number of entries found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const iVector2f& point, std::vector<void*>& results) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the entries visible through a view
+    ///
+    /// \param view    View to test
+    /// \param results Vector the user data of the entries is appended to
+    ///
+    /// \return Number of entries found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const View& view, std::vector<void*>& results) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Axis-aligned box, stored by its edges for fast tests
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Box
+    {
+        float left;   ///< Left edge
+        float top;    ///< Top edge
+        float right;  ///< Right edge
+        float bottom; ///< Bottom edge
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Node of the tree
+    ///
+    /// Leaves hold the entries; internal nodes always have two
+    /// children, and a box enclosing both of them.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Node
+    {
+        Box   box;         ///< Bounds of the entry or of the subtree
+        void* userData;    ///< User data of the entry, for leaves
+        int   parent;      ///< Parent node, or next free node when the node is unused
+        int   children[2]; ///< Children, NullEntry for leaves
+        int   height;      ///< 0 for leaves, -1 for unused nodes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take a node from the free list, growing the pool if needed
+    ///
+    /// \return Index of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    int allocateNode();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a node back to the free list
+    ///
+    /// \param node Index of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    void freeNode(int node);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a leaf next to the sibling that enlarges the tree the least
+    ///
+    /// \param leaf Index of the leaf
+    ///
+    ////////////////////////////////////////////////////////////
+    void insertLeaf(int leaf);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Detach a leaf from the tree
+    ///
+    /// \param leaf Index of the leaf
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeLeaf(int leaf);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rotate a subtree if it is unbalanced
+    ///
+    /// \param node Root of the subtree
+    ///
+    /// \return New root of the subtree
+    ///
+    ////////////////////////////////////////////////////////////
+    int balance(int node);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Refresh the boxes and heights from a node up to the root
+    ///
+    /// \param node First node to refresh
+    ///
+    ////////////////////////////////////////////////////////////
+    void refreshAncestors(int node);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Collect the entries whose box overlaps a box
+    ///
+    /// \param box     Box to test
+    /// \param results Vector the user data of the entries is appended to
+    ///
+    /// \return Number of entries found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const Box& box, std::vector<void*>& results) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Node> m_nodes;      ///< Pool of nodes, used and unused
+    int               m_root;       ///< Root node, NullEntry when the tree is empty
+    int               m_freeList;   ///< First unused node, NullEntry when the pool is full
+    std::size_t       m_entryCount; ///< Number of leaves
+    float             m_margin;     ///< Enlargement of the stored bounds
+};
+
+} // namespace sf
+
+
+#endif // SFML_SPATIALINDEX_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialIndex
+/// \ingroup graphics
+///
+/// sf::SpatialIndex answers "what is in this area?" without
+/// testing every object: it is a dynamic bounding volume tree,
+/// where every entry is a leaf and every internal node encloses
+/// its two children. A rectangle query only visits the branches
+/// overlapping the rectangle, which makes it logarithmic in the
+/// number of entries rather than linear. New leaves are placed
+/// where they enlarge the tree the least, and subtrees are
+/// rotated to keep the tree balanced.
+///
+/// Entries are stored with bounds enlarged by a margin, so that
+/// an object moving a little doesn't have to be moved in the
+/// tree: update() returns immediately in that case. Combined
+/// with sf::Transformable::getTransformRevision(), only the
+/// objects whose transform changed need to be updated at all.
+///
+/// The index doesn't own nor watch the objects: it only knows
+/// their bounds and a user pointer. Changes of geometry that
+/// don't go through the transform (a shape resized, a sprite
+/// given another texture rectangle, ...) must be reported with
+/// update() as well.
+///
+/// Usage example:
+/// \code
+/// struct Entity
+/// {
+///     sf::Sprite   sprite;
+///     int          entry;
+///     sf::Uint32   revision;
+/// };
+///
+/// sf::SpatialIndex index;
+/// for (Entity& entity : entities)
+/// {
+///     entity.entry    = index.insert(entity.sprite.getGlobalBounds(), &entity);
+///     entity.revision = entity.sprite.getTransformRevision();
+/// }
+///
+/// // Every frame: refresh the entities that moved...
+/// for (Entity& entity : entities)
+/// {
+///     if (entity.sprite.getTransformRevision() != entity.revision)
+///     {
+///         index.update(entity.entry, entity.sprite.getGlobalBounds());
+///         entity.revision = entity.sprite.getTransformRevision();
+///     }
+/// }
+///
+/// // ...and only draw the visible ones
+/// std::vector<void*> visible;
+/// index.query(target.getView(), visible);
+/// for (std::size_t i = 0; i < visible.size(); ++i)
+///     target.draw(static_cast<Entity*>(visible[i])->sprite);
+/// \endcode
+///
+/// \see sf::RenderTarget::cull, sf::Transformable
+///
+////////////////////////////////////////////////////////////
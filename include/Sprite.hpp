@@ -64,7 +64,7 @@ public:
     /// \see setTexture
     ///
     ////////////////////////////////////////////////////////////
-    explicit Sprite( Texture2D& texture);
+    explicit Sprite(const Texture2D& texture);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the sprite from a sub-rectangle of a source texture
@@ -75,7 +75,7 @@ public:
     /// \see setTexture, setTextureRect
     ///
     ////////////////////////////////////////////////////////////
-    Sprite( Texture2D& texture, const IntRect& rectangle);
+    Sprite(const Texture2D& texture, const IntRect& rectangle);
 
     ////////////////////////////////////////////////////////////
     /// \brief Change the source texture of the sprite
@@ -96,7 +96,7 @@ public:
     /// \see getTexture, setTextureRect
     ///
     ////////////////////////////////////////////////////////////
-    void setTexture( Texture2D& texture, bool resetRect = false);
+    void setTexture(const Texture2D& texture, bool resetRect = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Set the sub-rectangle of the texture that the sprite will display
@@ -189,17 +189,18 @@ public:
     ////////////////////////////////////////////////////////////
     FloatRect getGlobalBounds() const;
 
-        ////////////////////////////////////////////////////////////
+private:
+
+    friend class SpriteBatch;
+
+    ////////////////////////////////////////////////////////////
     /// \brief Draw the sprite to a render target
     ///
     /// \param target Render target to draw to
     /// \param states Current render states
     ///
     ////////////////////////////////////////////////////////////
-    virtual void draw() const;
-
-private:
-
+    virtual void draw(RenderTarget& target, RenderStates states) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the vertices' positions
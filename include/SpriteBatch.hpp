@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SPRITEBATCH_HPP
+#define SFML_SPRITEBATCH_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Drawable.hpp"
+#include "NonCopyable.hpp"
+#include "Transform.hpp"
+#include "Vertex.hpp"
+#include "PrimitiveType.hpp"
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+class Sprite;
+class Shape;
+class VertexArray;
+
+////////////////////////////////////////////////////////////
+/// \brief Collects sprites, shapes and vertex arrays and
+///        draws them grouped by texture
+///
+////////////////////////////////////////////////////////////
+class  SpriteBatch : public Drawable, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the last submitted batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t itemCount;            ///< Number of objects added to the batch
+        std::size_t vertexCount;          ///< Number of vertices submitted
+        std::size_t drawCalls;            ///< Number of draw calls actually issued
+        std::size_t drawCallsSaved;       ///< Draw calls avoided compared to drawing every object on its own
+        std::size_t textureSwitches;      ///< Number of texture changes actually issued
+        std::size_t textureSwitchesSaved; ///< Texture changes avoided by sorting the objects by texture
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty batch.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the objects from the batch
+    ///
+    /// The memory used by the batch is kept, so that filling
+    /// it again on the next frame doesn't reallocate anything.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite to the batch
+    ///
+    /// The vertices of the sprite are transformed on the CPU
+    /// with its current transform and copied into the batch;
+    /// modifying the sprite afterwards doesn't affect the batch.
+    ///
+    /// \param sprite Sprite to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a shape (fill and outline) to the batch
+    ///
+    /// \param shape Shape to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Shape& shape);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a vertex array to the batch
+    ///
+    /// \param vertices  Vertex array to add
+    /// \param transform Transform to apply to the vertices
+    /// \param texture   Texture to use, or NULL for no texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const VertexArray& vertices, const Transform& transform = Transform::Identity, const Texture2D* texture = NULL);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the last call to draw
+    ///
+    /// \return Statistics of the last submitted batch
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the content of the batch to a render target
+    ///
+    /// Each texture group is submitted with a single draw call.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertices sharing the same texture and primitive type
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Group
+    {
+        Texture2D           texture;  ///< Texture of the group, with an identifier of 0 for none
+        PrimitiveType       type;     ///< Type of primitives (Points, Lines or Triangles)
+        std::vector<Vertex> vertices; ///< Transformed vertices of the group
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the group matching a texture and a primitive type, creating it if needed
+    ///
+    /// \param texture Texture, or NULL for none
+    /// \param type    Type of primitives (Points, Lines or Triangles)
+    ///
+    /// \return Vertex storage of the group
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<Vertex>& getGroup(const Texture2D* texture, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Account for a draw call an object would issue on its own
+    ///
+    /// \param texture Texture used by the draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    void registerDrawCall(unsigned int texture);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Group>                  m_groups;          ///< Vertex groups, kept across frames to reuse their memory
+    std::map<Uint64, std::size_t>       m_groupIndices;    ///< Group index by sort key (texture, primitive type)
+    std::size_t                         m_itemCount;       ///< Number of objects added since the last clear
+    std::size_t                         m_naiveDrawCalls;  ///< Draw calls the objects would issue on their own
+    std::size_t                         m_naiveSwitches;   ///< Texture switches the objects would issue in submission order
+    unsigned int                        m_lastTexture;     ///< Texture of the last added object
+    mutable Statistics                  m_statistics;      ///< Counters of the last draw
+};
+
+} // namespace sf
+
+
+#endif // SFML_SPRITEBATCH_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// Drawing each sprite or shape on its own costs a matrix
+/// push, a texture bind and a draw call per object.
+/// With thousands of objects per frame, this state churn
+/// dominates the cost of the vertices themselves.
+///
+/// sf::SpriteBatch collects the objects of a frame, transforms
+/// their vertices on the CPU and stores them in one group per
+/// texture. When the batch is drawn, the groups are submitted
+/// in texture order, each one with a single draw call to the
+/// render target.
+///
+/// Since the objects are reordered by texture, objects using
+/// different textures are not guaranteed to be drawn in the
+/// order they were added. Objects sharing a texture keep their
+/// relative order.
+///
+/// Usage example:
+/// \code
+/// sf::SpriteBatch batch;
+///
+/// // every frame
+/// batch.clear();
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     batch.add(sprites[i]);
+/// batch.add(background);
+/// target.draw(batch);
+///
+/// const sf::SpriteBatch::Statistics& stats = batch.getStatistics();
+/// printf("%u draw calls saved\n", (unsigned)stats.drawCallsSaved);
+/// \endcode
+///
+/// \see sf::Sprite, sf::Shape, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
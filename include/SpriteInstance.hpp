@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SPRITEINSTANCE_HPP
+#define SFML_SPRITEINSTANCE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Color.hpp"
+#include "Transform.hpp"
+#include "Vector2.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Per-instance data of a sprite drawn with
+///        RenderTarget::drawInstanced
+///
+////////////////////////////////////////////////////////////
+class  SpriteInstance
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The instance has the identity transform and is white.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteInstance();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the instance from a transform and a color
+    ///
+    /// Only the 2D affine part of the transform is kept.
+    ///
+    /// \param transform Transform of the instance
+    /// \param theColor  Color of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteInstance(const Transform& transform, const iColor& theColor = iColor::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform of the instance
+    ///
+    /// \param transform New transform of the instance
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransform(const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform a point by the transform of the instance
+    ///
+    /// \param point Point to transform
+    ///
+    /// \return Transformed point
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f transformPoint(const iVector2f& point) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float  matrix[6]; ///< Rows of the 2x3 affine transform: a00, a01, a02, a10, a11, a12
+    iColor color;     ///< Color modulating the texture of the instance
+};
+
+} // namespace sf
+
+
+#endif // SFML_SPRITEINSTANCE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteInstance
+/// \ingroup graphics
+///
+/// sf::SpriteInstance is the packed description of one copy of
+/// a sprite drawn with sf::RenderTarget::drawInstanced: an affine
+/// transform and a color, 28 bytes, against four 20-byte vertices
+/// for a sprite drawn on its own. Arrays of instances are sent to
+/// the GPU as they are, so the layout of the class is part of its
+/// interface.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::SpriteInstance> bullets(count);
+/// for (std::size_t i = 0; i < count; ++i)
+/// {
+///     sf::Transformable transformable;
+///     transformable.setPosition(positions[i]);
+///     transformable.setRotation(angles[i]);
+///     bullets[i] = sf::SpriteInstance(transformable.getTransform(), sf::iColor::Yellow);
+/// }
+///
+/// target.drawInstanced(texture, sf::IntRect(0, 0, 8, 8), &bullets[0], bullets.size());
+/// \endcode
+///
+/// \see sf::RenderTarget, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREATLAS_HPP
+#define SFML_TEXTUREATLAS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Config.hpp"
+#include "NonCopyable.hpp"
+#include "Rect.hpp"
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Packs many images into a few large textures
+///
+////////////////////////////////////////////////////////////
+class  TextureAtlas : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Region
+    {
+        Texture2D   texture; ///< Texture of the page holding the image
+        IntRect     rect;    ///< Area of the image in the page, in pixels
+        std::size_t page;    ///< Index of the page holding the image
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas
+    ///
+    /// Pages are created on demand, when an image doesn't fit
+    /// in the existing ones.
+    ///
+    /// \param pageSize Width and height of the pages, in pixels
+    /// \param padding  Pixels left around every image, filled with
+    ///                 copies of its border to avoid bleeding
+    ///                 when the texture is filtered
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(unsigned int pageSize = 2048, unsigned int padding = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unloads the textures of the pages.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// \param image  Image to add
+    /// \param region Receives the location of the image in the atlas
+    ///
+    /// \return True if the image was added, false if it is empty
+    ///         or too large to fit in a page
+    ///
+    ////////////////////////////////////////////////////////////
+    bool add(const Image& image, Region& region);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an image file and add it to the atlas
+    ///
+    /// \param filename Path of the image file to load
+    /// \param region   Receives the location of the image in the atlas
+    ///
+    /// \return True if the image was loaded and added
+    ///
+    ////////////////////////////////////////////////////////////
+    bool addFromFile(const std::string& filename, Region& region);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove every image and unload the pages
+    ///
+    /// The regions returned so far become invalid.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pages
+    ///
+    /// \return Number of textures the images are packed into
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a page
+    ///
+    /// \param index Index of the page
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture2D& getPageTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the proportion of the pages covered by images
+    ///
+    /// \return Used area over total area of the pages, padding
+    ///         included, between 0 and 1
+    ///
+    ////////////////////////////////////////////////////////////
+    float getOccupancy() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Segment of the skyline of a page
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SkylineNode
+    {
+        int x;     ///< Left of the segment
+        int y;     ///< Height of the segment, from the top of the page
+        int width; ///< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture the images are packed into
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Page
+    {
+        Texture2D                texture;  ///< Texture of the page
+        std::vector<SkylineNode> skyline;  ///< Top of the packed images, from left to right
+        Uint64                   usedArea; ///< Area of the packed images, padding included
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve an area in a page
+    ///
+    /// \param page   Page to pack into
+    /// \param width  Width of the area
+    /// \param height Height of the area
+    /// \param area   Receives the reserved area
+    ///
+    /// \return True if the area fits in the page
+    ///
+    ////////////////////////////////////////////////////////////
+    bool pack(Page& page, int width, int height, IntRect& area);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    int               m_pageSize; ///< Width and height of the pages
+    int               m_padding;  ///< Pixels around every image
+    std::vector<Page> m_pages;    ///< Pages of the atlas
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTUREATLAS_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Drawing sprites that come from different textures breaks
+/// the batch on every texture change. sf::TextureAtlas packs
+/// many small images into a few large textures, the pages, so
+/// that a whole scene draws with a handful of texture binds.
+///
+/// Images are packed with the skyline bottom-left heuristic:
+/// every page keeps the outline of its packed images, and an
+/// image goes where its bottom edge is the highest. Pages
+/// have a fixed size, so the regions of the images already
+/// packed never move.
+///
+/// A region gives the texture of its page and the area of the
+/// image in it, which is all sf::Sprite and sf::Shape need.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// sf::TextureAtlas::Region player, enemy;
+/// atlas.addFromFile("player.png", player);
+/// atlas.addFromFile("enemy.png", enemy);
+///
+/// sf::Sprite sprite;
+/// sprite.setTexture(player.texture);
+/// sprite.setTextureRect(player.rect);
+///
+/// sf::RectangleShape shape(sf::iVector2f(32, 32));
+/// shape.setTexture(enemy.texture);
+/// shape.setTextureRect(enemy.rect);
+/// \endcode
+///
+/// \see sf::Sprite, sf::Shape
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TILEMAP_HPP
+#define SFML_TILEMAP_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Drawable.hpp"
+#include "Transformable.hpp"
+#include "VertexBuffer.hpp"
+#include "Rect.hpp"
+#include <deque>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles taken from a tileset texture,
+///        drawn by chunks
+///
+////////////////////////////////////////////////////////////
+class  TileMap : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map
+    ///
+    /// \param chunkSize Width and height of the chunks, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TileMap(unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the tiles and the tileset of the map
+    ///
+    /// The tiles of the tileset are numbered row by row, from
+    /// its top-left corner. A negative tile number leaves the
+    /// cell empty.
+    ///
+    /// \param tileset  Texture holding the tiles
+    /// \param tileSize Size of a tile, in pixels
+    /// \param tiles    Tile numbers, row by row, width * height of them
+    /// \param width    Width of the map, in tiles
+    /// \param height   Height of the map, in tiles
+    ///
+    /// \return True if the map was loaded, false if a size is zero
+    ///
+    ////////////////////////////////////////////////////////////
+    bool load(const Texture2D& tileset, const iVector2u& tileSize, const int* tiles, unsigned int width, unsigned int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a single tile
+    ///
+    /// Only the four vertices of the tile are rewritten, if its
+    /// chunk has geometry cached. The vertex buffer of a chunk
+    /// uploads a single range, so the tiles of a chunk changed
+    /// between two draws are uploaded with every tile between
+    /// them.
+    ///
+    /// \param x    Column of the tile
+    /// \param y    Row of the tile
+    /// \param tile New tile number, negative for an empty cell
+    ///
+    /// \see getTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(unsigned int x, unsigned int y, int tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile
+    ///
+    /// \param x Column of the tile
+    /// \param y Row of the tile
+    ///
+    /// \return Tile number, negative for an empty cell
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    int getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    const iVector2u& getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    const iVector2u& getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of chunks whose geometry is kept
+    ///
+    /// The geometry of a chunk is built the first time it is
+    /// visible, and kept for the next frames. Past this budget,
+    /// the chunks that were drawn the longest time ago give their
+    /// vertex buffer to the newly visible ones. Chunks visible in
+    /// the same draw are never evicted, so the budget is exceeded
+    /// when the view shows more chunks than it allows.
+    /// Lowering the budget releases every cached chunk.
+    ///
+    /// \param chunkCount Maximum number of cached chunks
+    ///
+    /// \see getCacheBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCacheBudget(std::size_t chunkCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks whose geometry is kept
+    ///
+    /// \return Maximum number of cached chunks
+    ///
+    /// \see setCacheBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCacheBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks that currently have geometry
+    ///
+    /// \return Number of cached chunks
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCachedChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the chunks visible through the view of the target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached geometry of a chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        Slot();
+
+        VertexBuffer vertices;  ///< One quad per cell of the chunk, row by row
+        std::size_t  chunk;     ///< Index of the chunk using the slot
+        Uint64       lastDrawn; ///< Value of the draw counter when the chunk was last drawn
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the slot holding the geometry of a chunk,
+    ///        building it if needed
+    ///
+    /// \param chunk Index of the chunk
+    ///
+    /// \return Slot of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    Slot& acquireSlot(std::size_t chunk) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the geometry of every chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseSlots();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the quad of a cell
+    ///
+    /// \param quad Receives the four vertices of the quad
+    /// \param x    Column of the cell
+    /// \param y    Row of the cell
+    ///
+    ////////////////////////////////////////////////////////////
+    void getQuad(Vertex* quad, unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture2D                        m_tileset;     ///< Texture holding the tiles
+    iVector2u                        m_tileSize;    ///< Size of a tile, in pixels
+    iVector2u                        m_size;        ///< Size of the map, in tiles
+    unsigned int                     m_chunkSize;   ///< Size of a chunk, in tiles
+    iVector2u                        m_chunkCount;  ///< Number of chunk columns and rows
+    std::vector<int>                 m_tiles;       ///< Tile numbers, row by row
+    std::size_t                      m_cacheBudget; ///< Maximum number of cached chunks
+    mutable std::vector<std::size_t> m_chunkSlots;  ///< Slot of every chunk, or NoSlot
+    mutable std::deque<Slot>         m_slots;       ///< Cached chunk geometries, never moved once created
+    mutable std::vector<Vertex>      m_scratch;     ///< Vertices of the chunk being built
+    mutable Uint64                   m_drawCount;   ///< Number of draws so far
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEMAP_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a level made of a grid of tiles, all
+/// taken from the same tileset texture. The map is split into
+/// square chunks; when it is drawn, only the chunks overlapping
+/// the view of the render target are drawn, each one with a
+/// single vertex buffer. The cost of a frame thus depends on the
+/// size of the view, not on the size of the map.
+///
+/// The geometry of a chunk is built the first time the chunk
+/// is visible and kept in GPU memory afterwards, up to a budget
+/// of chunks (see setCacheBudget): very large maps don't need
+/// the geometry of every chunk at once. Changing a tile with
+/// setTile only rewrites the four vertices of the tile; when
+/// several tiles of a chunk change between two draws, the range
+/// spanning all of them is uploaded again.
+///
+/// It inherits all the functions from sf::Transformable:
+/// position, rotation, scale, origin.
+///
+/// Usage example:
+/// \code
+/// std::vector<int> level(4096 * 4096, 0);
+///
+/// sf::TileMap map;
+/// map.load(tileset, sf::iVector2u(32, 32), &level[0], 4096, 4096);
+///
+/// // Open a door
+/// map.setTile(120, 54, 7);
+///
+/// view.move(scrollSpeed * elapsed.asSeconds(), 0.f);
+/// target.setView(view);
+/// target.draw(map);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::View
+///
+////////////////////////////////////////////////////////////
@@ -31,12 +31,13 @@
 #include "Export.hpp"
 #include "Rect.hpp"
 #include "Vector2.hpp"
+#include <cstddef>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Define a 3x3 transform matrix
+/// \brief Define a 2D affine transform matrix
 ///
 ////////////////////////////////////////////////////////////
 class  Transform
@@ -49,11 +50,15 @@ public:
     /// Creates an identity transform (a transform that does nothing).
     ///
     ////////////////////////////////////////////////////////////
-    Transform();
+    constexpr Transform();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a transform from a 3x3 matrix
     ///
+    /// Only affine transforms are supported: the last row of
+    /// the matrix is always (0, 0, 1), and \a a20, \a a21 and
+    /// \a a22 are ignored.
+    ///
     /// \param a00 Element (0, 0) of the matrix
     /// \param a01 Element (0, 1) of the matrix
     /// \param a02 Element (0, 2) of the matrix
@@ -65,26 +70,40 @@ public:
     /// \param a22 Element (2, 2) of the matrix
     ///
     ////////////////////////////////////////////////////////////
-    Transform(float a00, float a01, float a02,
-              float a10, float a11, float a12,
-              float a20, float a21, float a22);
+    constexpr Transform(float a00, float a01, float a02,
+                        float a10, float a11, float a12,
+                        float a20, float a21, float a22);
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the transform as a 4x4 matrix
     ///
-    /// This function returns a pointer to an array of 16 floats
-    /// containing the transform elements as a 4x4 matrix, which
-    /// is directly compatible with OpenGL functions.
+    /// This function writes the transform elements into an array
+    /// of 16 floats, as a 4x4 matrix stored by columns, which is
+    /// directly compatible with OpenGL functions.
     ///
     /// \code
     /// sf::Transform transform = ...;
-    /// glLoadMatrixf(transform.getMatrix());
+    /// float matrix[16];
+    /// transform.getMatrix(matrix);
+    /// rlMultMatrixf(matrix);
     /// \endcode
     ///
-    /// \return Pointer to a 4x4 matrix
+    /// \param matrix Array of 16 floats receiving the matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void getMatrix(float* matrix) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the elements of the transform
+    ///
+    /// This function returns a pointer to an array of 6 floats
+    /// containing the first two rows of the matrix, stored by
+    /// columns: a00, a10, a01, a11, a02, a12.
+    ///
+    /// \return Pointer to a 2x3 matrix
     ///
     ////////////////////////////////////////////////////////////
-    const float* getMatrix() const;
+    constexpr const float* getAffineMatrix() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the inverse of the transform
@@ -106,7 +125,7 @@ public:
     /// \return Transformed point
     ///
     ////////////////////////////////////////////////////////////
-    iVector2f transformPoint(float x, float y) const;
+    constexpr iVector2f transformPoint(float x, float y) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Transform a 2D point
@@ -116,7 +135,7 @@ public:
     /// \return Transformed point
     ///
     ////////////////////////////////////////////////////////////
-    iVector2f transformPoint(const iVector2f& point) const;
+    constexpr iVector2f transformPoint(const iVector2f& point) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
@@ -134,6 +153,35 @@ public:
     ////////////////////////////////////////////////////////////
     FloatRect transformRect(const FloatRect& rectangle) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This is equivalent to calling transformPoint on every
+    /// point, but processes several points at once with SIMD
+    /// instructions when they are available. \a points and
+    /// \a result may be the same array.
+    ///
+    /// \param points Points to transform
+    /// \param result Array receiving the transformed points
+    /// \param count  Number of points in both arrays
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const iVector2f* points, iVector2f* result, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of rectangles
+    ///
+    /// This is equivalent to calling transformRect on every
+    /// rectangle. \a rectangles and \a result may be the same
+    /// array.
+    ///
+    /// \param rectangles Rectangles to transform
+    /// \param result     Array receiving the transformed rectangles
+    /// \param count      Number of rectangles in both arrays
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformRects(const FloatRect* rectangles, FloatRect* result, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Combine the current transform with another one
     ///
@@ -358,7 +406,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float m_matrix[16]; ///< 4x4 matrix defining the transformation
+    float m_matrix[6]; ///< First two rows of the 3x3 matrix, stored by columns
 };
 
 ////////////////////////////////////////////////////////////
@@ -401,7 +449,7 @@ private:
 /// \return New transformed point
 ///
 ////////////////////////////////////////////////////////////
- iVector2f operator *(const Transform& left, const iVector2f& right);
+constexpr iVector2f operator *(const Transform& left, const iVector2f& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates sf::Transform
@@ -416,7 +464,7 @@ private:
 /// \return true if the transforms are equal, false otherwise
 ///
 ////////////////////////////////////////////////////////////
- bool operator ==(const Transform& left, const Transform& right);
+constexpr bool operator ==(const Transform& left, const Transform& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates sf::Transform
@@ -430,7 +478,9 @@ private:
 /// \return true if the transforms are not equal, false otherwise
 ///
 ////////////////////////////////////////////////////////////
- bool operator !=(const Transform& left, const Transform& right);
+constexpr bool operator !=(const Transform& left, const Transform& right);
+
+#include "Transform.inl"
 
 } // namespace sf
 
@@ -443,7 +493,7 @@ private:
 /// \ingroup graphics
 ///
 /// A sf::Transform specifies how to translate, rotate, scale,
-/// shear, project, whatever things. In mathematical terms, it defines
+/// shear, whatever things. In mathematical terms, it defines
 /// how to transform a coordinate system into another.
 ///
 /// For example, if you apply a rotation transform to a sprite, the
@@ -474,6 +524,18 @@ private:
 /// sf::FloatRect rect = transform.transformRect(sf::FloatRect(0, 0, 10, 100));
 /// \endcode
 ///
+/// Only affine transforms are represented: the matrix keeps its
+/// 6 meaningful elements, so that combining, inverting and
+/// transforming need a fraction of the work of a full 3x3 or 4x4
+/// matrix. These operations use SSE2 when it is available, and
+/// transformPoints and transformRects process whole arrays at
+/// once, which is faster than transforming the elements one by
+/// one on the CPU side:
+/// \code
+/// std::vector<sf::iVector2f> points = ...;
+/// transform.transformPoints(&points[0], &points[0], points.size());
+/// \endcode
+///
 /// \see sf::Transformable, sf::RenderStates
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+
+////////////////////////////////////////////////////////////
+constexpr Transform::Transform() :
+m_matrix{1.f, 0.f,
+         0.f, 1.f,
+         0.f, 0.f}
+{
+    // Identity matrix
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr Transform::Transform(float a00, float a01, float a02,
+                               float a10, float a11, float a12,
+                               float, float, float) :
+m_matrix{a00, a10,
+         a01, a11,
+         a02, a12}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr const float* Transform::getAffineMatrix() const
+{
+    return m_matrix;
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr iVector2f Transform::transformPoint(float x, float y) const
+{
+    return iVector2f(m_matrix[0] * x + m_matrix[2] * y + m_matrix[4],
+                     m_matrix[1] * x + m_matrix[3] * y + m_matrix[5]);
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr iVector2f Transform::transformPoint(const iVector2f& point) const
+{
+    return transformPoint(point.x, point.y);
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr iVector2f operator *(const Transform& left, const iVector2f& right)
+{
+    return left.transformPoint(right);
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr bool operator ==(const Transform& left, const Transform& right)
+{
+    const float* a = left.getAffineMatrix();
+    const float* b = right.getAffineMatrix();
+
+    return ((a[0] == b[0]) && (a[1] == b[1]) && (a[2] == b[2]) &&
+            (a[3] == b[3]) && (a[4] == b[4]) && (a[5] == b[5]));
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr bool operator !=(const Transform& left, const Transform& right)
+{
+    return !(left == right);
+}
+
+
+////////////////////////////////////////////////////////////
+// Static member data
+////////////////////////////////////////////////////////////
+inline constexpr Transform Transform::Identity;
@@ -0,0 +1,316 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TRANSFORMSYSTEM_HPP
+#define SFML_TRANSFORMSYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "NonCopyable.hpp"
+#include "Transform.hpp"
+#include "Vector2.hpp"
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+    class ThreadPool;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Position, rotation, scale and origin of many
+///        objects, with their transforms computed in bulk
+///
+////////////////////////////////////////////////////////////
+class  TransformSystem : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty system
+    ///
+    /// \param threadCount Number of threads computing the transforms,
+    ///                    0 to share the threads of the library, one
+    ///                    per hardware core
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TransformSystem(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TransformSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object
+    ///
+    /// The object starts at position (0, 0), with no rotation,
+    /// a scale of (1, 1) and its origin at (0, 0).
+    ///
+    /// \return Handle of the new object
+    ///
+    ////////////////////////////////////////////////////////////
+    int create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object
+    ///
+    /// The handle may be given again by a later call to create.
+    ///
+    /// \param handle Handle of the object, as returned by create
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroy(int handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove every object
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects
+    ///
+    /// \return Number of objects
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of an object
+    ///
+    /// \param handle   Handle of the object
+    /// \param position New position
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(int handle, const iVector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the orientation of an object
+    ///
+    /// \param handle Handle of the object
+    /// \param angle  New rotation, in degrees
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(int handle, float angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of an object
+    ///
+    /// \param handle  Handle of the object
+    /// \param factors New scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(int handle, const iVector2f& factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of an object
+    ///
+    /// \param handle Handle of the object
+    /// \param origin New origin
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(int handle, const iVector2f& origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of an object
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Current position
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f getPosition(int handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the orientation of an object
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Current rotation, in degrees, in the range [0, 360]
+    ///
+    ////////////////////////////////////////////////////////////
+    float getRotation(int handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of an object
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Current scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f getScale(int handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of an object
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Current origin
+    ///
+    ////////////////////////////////////////////////////////////
+    iVector2f getOrigin(int handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the transforms of the modified objects
+    ///
+    /// Call this once per frame, after moving the objects and
+    /// before drawing them.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of an object
+    ///
+    /// The transform is the one computed by the last call to
+    /// update; it is the same as the one of a sf::Transformable
+    /// with the same position, rotation, scale and origin.
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Transform of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    const Transform& getTransform(int handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transforms of all the objects
+    ///
+    /// The objects are packed in an order which changes when
+    /// objects are destroyed; use getIndex to find the transform
+    /// of a given object, or getHandles to know which object
+    /// every transform belongs to.
+    ///
+    /// \return Pointer to getCount() transforms, NULL if there are none
+    ///
+    ////////////////////////////////////////////////////////////
+    const Transform* getTransforms() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handles of all the objects
+    ///
+    /// \return Pointer to getCount() handles, in the order of getTransforms
+    ///
+    ////////////////////////////////////////////////////////////
+    const int* getHandles() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of an object in the packed arrays
+    ///
+    /// \param handle Handle of the object
+    ///
+    /// \return Index of the object in getTransforms and getHandles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getIndex(int handle) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the dirty transforms of a chunk of objects
+    ///
+    /// \param chunk Index of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(std::size_t chunk);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<float>     m_positionsX;  ///< Horizontal positions of the objects
+    std::vector<float>     m_positionsY;  ///< Vertical positions of the objects
+    std::vector<float>     m_rotations;   ///< Rotations of the objects, in degrees
+    std::vector<float>     m_scalesX;     ///< Horizontal scale factors of the objects
+    std::vector<float>     m_scalesY;     ///< Vertical scale factors of the objects
+    std::vector<float>     m_originsX;    ///< Horizontal origins of the objects
+    std::vector<float>     m_originsY;    ///< Vertical origins of the objects
+    std::vector<Uint8>     m_dirty;       ///< Whether the transform of each object must be recomputed
+    std::vector<Transform> m_transforms;  ///< Transforms of the objects, as of the last update
+    std::vector<int>       m_handles;     ///< Handle of each object
+    std::vector<int>       m_indices;     ///< Index of the object of each handle, -1 for free handles
+    std::vector<int>       m_freeHandles; ///< Handles available for reuse
+    bool                   m_needUpdate;  ///< Whether any object is dirty
+    priv::ThreadPool*      m_threadPool;  ///< Threads updating the chunks
+};
+
+} // namespace sf
+
+
+#endif // SFML_TRANSFORMSYSTEM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TransformSystem
+/// \ingroup graphics
+///
+/// sf::TransformSystem is an alternative to sf::Transformable
+/// for scenes with many moving objects. Instead of every object
+/// storing its components and computing its own transform when
+/// it is drawn, the system stores the components of all the
+/// objects as a structure of arrays, addressed by handle, and
+/// update() recomputes every modified transform in one pass.
+///
+/// The objects are split into chunks updated in parallel, and
+/// the transforms of four objects are combined at once with SSE2
+/// when it is available. The objects are kept packed, so the
+/// pass only walks contiguous memory: destroying an object moves
+/// the last one in its place, while the handles stay valid.
+///
+/// The transforms are plain sf::Transform values, that can be
+/// given to the render states of draw calls, to a sf::SpriteBatch,
+/// or turned into sf::SpriteInstance for instanced drawing, with
+/// no virtual call per object.
+///
+/// Usage example:
+/// \code
+/// sf::TransformSystem transforms;
+///
+/// std::vector<int> handles(count);
+/// for (std::size_t i = 0; i < count; ++i)
+///     handles[i] = transforms.create();
+///
+/// while (!WindowShouldClose())
+/// {
+///     for (std::size_t i = 0; i < count; ++i)
+///         transforms.setRotation(handles[i], angles[i]);
+///
+///     transforms.update();
+///
+///     for (std::size_t i = 0; i < count; ++i)
+///         instances[i].setTransform(transforms.getTransform(handles[i]));
+///     target.drawInstanced(texture, rect, &instances[0], count);
+/// }
+/// \endcode
+///
+/// \see sf::Transformable, sf::Transform
+///
+////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
+#include "CacheState.hpp"
 #include "Transform.hpp"
 
 
@@ -294,6 +295,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief get the combined transform of the object
     ///
+    /// The transform is computed on the first call after the
+    /// object changed. Several threads may call this function
+    /// at once, as long as none of them modifies the object.
+    ///
     /// \return Transform combining the position/rotation/scale/origin of the object
     ///
     /// \see getInverseTransform
@@ -304,6 +309,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief get the inverse of the combined transform of the object
     ///
+    /// Like getTransform, this function can be called from
+    /// several threads at once.
+    ///
     /// \return Inverse of the combined transformations applied to the object
     ///
     /// \see getTransform
@@ -311,19 +319,35 @@ public:
     ////////////////////////////////////////////////////////////
     const Transform& getInverseTransform() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief get the revision of the transform of the object
+    ///
+    /// The revision is incremented every time the position,
+    /// rotation, scale or origin of the object is changed. Code
+    /// caching something derived from the transform, such as
+    /// the bounds of the object in a sf::SpatialIndex, can
+    /// compare it with the revision it last saw to know whether
+    /// the cached data is stale.
+    ///
+    /// \return Revision of the transform
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint32 getTransformRevision() const;
+
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    iVector2f          m_origin;                     ///< Origin of translation/rotation/scaling of the object
-    iVector2f          m_position;                   ///< Position of the object in the 2D world
-    float             m_rotation;                   ///< Orientation of the object, in degrees
-    iVector2f          m_scale;                      ///< Scale of the object
-    mutable Transform m_transform;                  ///< Combined transformation of the object
-    mutable bool      m_transformNeedUpdate;        ///< Does the transform need to be recomputed?
-    mutable Transform m_inverseTransform;           ///< Combined transformation of the object
-    mutable bool      m_inverseTransformNeedUpdate; ///< Does the transform need to be recomputed?
+    iVector2f         m_origin;                ///< Origin of translation/rotation/scaling of the object
+    iVector2f         m_position;              ///< Position of the object in the 2D world
+    float             m_rotation;              ///< Orientation of the object, in degrees
+    iVector2f         m_scale;                 ///< Scale of the object
+    mutable Transform m_transform;             ///< Combined transformation of the object
+    priv::CacheState  m_transformState;        ///< Is the transform up to date?
+    mutable Transform m_inverseTransform;      ///< Combined transformation of the object
+    priv::CacheState  m_inverseTransformState; ///< Is the inverse transform up to date?
+    Uint32            m_transformRevision;     ///< Incremented every time the transform changes
 };
 
 } // namespace sf
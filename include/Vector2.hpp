@@ -44,7 +44,7 @@ public:
     /// Creates a iVector2(0, 0).
     ///
     ////////////////////////////////////////////////////////////
-    iVector2();
+    constexpr iVector2();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the vector from its coordinates
@@ -53,7 +53,7 @@ public:
     /// \param Y Y coordinate
     ///
     ////////////////////////////////////////////////////////////
-    iVector2(T X, T Y);
+    constexpr iVector2(T X, T Y);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the vector from another type of vector
@@ -67,7 +67,7 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     template <typename U>
-    explicit iVector2(const iVector2<U>& vector);
+    constexpr explicit iVector2(const iVector2<U>& vector);
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -86,7 +86,7 @@ public:
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator -(const iVector2<T>& right);
+constexpr iVector2<T> operator -(const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -102,7 +102,7 @@ iVector2<T> operator -(const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right);
+constexpr iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -118,7 +118,7 @@ iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right);
+constexpr iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -131,7 +131,7 @@ iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right);
+constexpr iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -144,7 +144,7 @@ iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right);
+constexpr iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -157,7 +157,7 @@ iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator *(const iVector2<T>& left, T right);
+constexpr iVector2<T> operator *(const iVector2<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -170,7 +170,7 @@ iVector2<T> operator *(const iVector2<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator *(T left, const iVector2<T>& right);
+constexpr iVector2<T> operator *(T left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -186,7 +186,7 @@ iVector2<T> operator *(T left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T>& operator *=(iVector2<T>& left, T right);
+constexpr iVector2<T>& operator *=(iVector2<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -199,7 +199,7 @@ iVector2<T>& operator *=(iVector2<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T> operator /(const iVector2<T>& left, T right);
+constexpr iVector2<T> operator /(const iVector2<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -215,7 +215,7 @@ iVector2<T> operator /(const iVector2<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector2<T>& operator /=(iVector2<T>& left, T right);
+constexpr iVector2<T>& operator /=(iVector2<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -230,7 +230,7 @@ iVector2<T>& operator /=(iVector2<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-bool operator ==(const iVector2<T>& left, const iVector2<T>& right);
+constexpr bool operator ==(const iVector2<T>& left, const iVector2<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector2
@@ -245,7 +245,7 @@ bool operator ==(const iVector2<T>& left, const iVector2<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-bool operator !=(const iVector2<T>& left, const iVector2<T>& right);
+constexpr bool operator !=(const iVector2<T>& left, const iVector2<T>& right);
 
 #include "Vector2.inl"
 
@@ -25,7 +25,7 @@
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>::iVector2() :
+constexpr iVector2<T>::iVector2() :
 x(0),
 y(0)
 {
@@ -35,7 +35,7 @@ y(0)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>::iVector2(T X, T Y) :
+constexpr iVector2<T>::iVector2(T X, T Y) :
 x(X),
 y(Y)
 {
@@ -46,7 +46,7 @@ y(Y)
 ////////////////////////////////////////////////////////////
 template <typename T>
 template <typename U>
-inline iVector2<T>::iVector2(const iVector2<U>& vector) :
+constexpr iVector2<T>::iVector2(const iVector2<U>& vector) :
 x(static_cast<T>(vector.x)),
 y(static_cast<T>(vector.y))
 {
@@ -55,7 +55,7 @@ y(static_cast<T>(vector.y))
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator -(const iVector2<T>& right)
+constexpr iVector2<T> operator -(const iVector2<T>& right)
 {
     return iVector2<T>(-right.x, -right.y);
 }
@@ -63,7 +63,7 @@ inline iVector2<T> operator -(const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right)
+constexpr iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right)
 {
     left.x += right.x;
     left.y += right.y;
@@ -74,7 +74,7 @@ inline iVector2<T>& operator +=(iVector2<T>& left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right)
+constexpr iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right)
 {
     left.x -= right.x;
     left.y -= right.y;
@@ -85,7 +85,7 @@ inline iVector2<T>& operator -=(iVector2<T>& left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right)
+constexpr iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right)
 {
     return iVector2<T>(left.x + right.x, left.y + right.y);
 }
@@ -93,7 +93,7 @@ inline iVector2<T> operator +(const iVector2<T>& left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right)
+constexpr iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right)
 {
     return iVector2<T>(left.x - right.x, left.y - right.y);
 }
@@ -101,7 +101,7 @@ inline iVector2<T> operator -(const iVector2<T>& left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator *(const iVector2<T>& left, T right)
+constexpr iVector2<T> operator *(const iVector2<T>& left, T right)
 {
     return iVector2<T>(left.x * right, left.y * right);
 }
@@ -109,7 +109,7 @@ inline iVector2<T> operator *(const iVector2<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator *(T left, const iVector2<T>& right)
+constexpr iVector2<T> operator *(T left, const iVector2<T>& right)
 {
     return iVector2<T>(right.x * left, right.y * left);
 }
@@ -117,7 +117,7 @@ inline iVector2<T> operator *(T left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>& operator *=(iVector2<T>& left, T right)
+constexpr iVector2<T>& operator *=(iVector2<T>& left, T right)
 {
     left.x *= right;
     left.y *= right;
@@ -128,7 +128,7 @@ inline iVector2<T>& operator *=(iVector2<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T> operator /(const iVector2<T>& left, T right)
+constexpr iVector2<T> operator /(const iVector2<T>& left, T right)
 {
     return iVector2<T>(left.x / right, left.y / right);
 }
@@ -136,7 +136,7 @@ inline iVector2<T> operator /(const iVector2<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector2<T>& operator /=(iVector2<T>& left, T right)
+constexpr iVector2<T>& operator /=(iVector2<T>& left, T right)
 {
     left.x /= right;
     left.y /= right;
@@ -147,7 +147,7 @@ inline iVector2<T>& operator /=(iVector2<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline bool operator ==(const iVector2<T>& left, const iVector2<T>& right)
+constexpr bool operator ==(const iVector2<T>& left, const iVector2<T>& right)
 {
     return (left.x == right.x) && (left.y == right.y);
 }
@@ -155,7 +155,7 @@ inline bool operator ==(const iVector2<T>& left, const iVector2<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline bool operator !=(const iVector2<T>& left, const iVector2<T>& right)
+constexpr bool operator !=(const iVector2<T>& left, const iVector2<T>& right)
 {
     return (left.x != right.x) || (left.y != right.y);
 }
@@ -44,7 +44,7 @@ public:
     /// Creates a iVector3(0, 0, 0).
     ///
     ////////////////////////////////////////////////////////////
-    iVector3();
+    constexpr iVector3();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the vector from its coordinates
@@ -54,7 +54,7 @@ public:
     /// \param Z Z coordinate
     ///
     ////////////////////////////////////////////////////////////
-    iVector3(T X, T Y, T Z);
+    constexpr iVector3(T X, T Y, T Z);
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the vector from another type of vector
@@ -68,7 +68,7 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     template <typename U>
-    explicit iVector3(const iVector3<U>& vector);
+    constexpr explicit iVector3(const iVector3<U>& vector);
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -88,7 +88,7 @@ public:
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator -(const iVector3<T>& left);
+constexpr iVector3<T> operator -(const iVector3<T>& left);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -104,7 +104,7 @@ iVector3<T> operator -(const iVector3<T>& left);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right);
+constexpr iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -120,7 +120,7 @@ iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right);
+constexpr iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -133,7 +133,7 @@ iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right);
+constexpr iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -146,7 +146,7 @@ iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right);
+constexpr iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -159,7 +159,7 @@ iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator *(const iVector3<T>& left, T right);
+constexpr iVector3<T> operator *(const iVector3<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -172,7 +172,7 @@ iVector3<T> operator *(const iVector3<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator *(T left, const iVector3<T>& right);
+constexpr iVector3<T> operator *(T left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -188,7 +188,7 @@ iVector3<T> operator *(T left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T>& operator *=(iVector3<T>& left, T right);
+constexpr iVector3<T>& operator *=(iVector3<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -201,7 +201,7 @@ iVector3<T>& operator *=(iVector3<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T> operator /(const iVector3<T>& left, T right);
+constexpr iVector3<T> operator /(const iVector3<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -217,7 +217,7 @@ iVector3<T> operator /(const iVector3<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-iVector3<T>& operator /=(iVector3<T>& left, T right);
+constexpr iVector3<T>& operator /=(iVector3<T>& left, T right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -232,7 +232,7 @@ iVector3<T>& operator /=(iVector3<T>& left, T right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-bool operator ==(const iVector3<T>& left, const iVector3<T>& right);
+constexpr bool operator ==(const iVector3<T>& left, const iVector3<T>& right);
 
 ////////////////////////////////////////////////////////////
 /// \relates iVector3
@@ -247,7 +247,7 @@ bool operator ==(const iVector3<T>& left, const iVector3<T>& right);
 ///
 ////////////////////////////////////////////////////////////
 template <typename T>
-bool operator !=(const iVector3<T>& left, const iVector3<T>& right);
+constexpr bool operator !=(const iVector3<T>& left, const iVector3<T>& right);
 
 #include "Vector3.inl"
 
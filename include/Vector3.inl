@@ -25,7 +25,7 @@
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>::iVector3() :
+constexpr iVector3<T>::iVector3() :
 x(0),
 y(0),
 z(0)
@@ -36,7 +36,7 @@ z(0)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>::iVector3(T X, T Y, T Z) :
+constexpr iVector3<T>::iVector3(T X, T Y, T Z) :
 x(X),
 y(Y),
 z(Z)
@@ -48,7 +48,7 @@ z(Z)
 ////////////////////////////////////////////////////////////
 template <typename T>
 template <typename U>
-inline iVector3<T>::iVector3(const iVector3<U>& vector) :
+constexpr iVector3<T>::iVector3(const iVector3<U>& vector) :
 x(static_cast<T>(vector.x)),
 y(static_cast<T>(vector.y)),
 z(static_cast<T>(vector.z))
@@ -58,7 +58,7 @@ z(static_cast<T>(vector.z))
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator -(const iVector3<T>& left)
+constexpr iVector3<T> operator -(const iVector3<T>& left)
 {
     return iVector3<T>(-left.x, -left.y, -left.z);
 }
@@ -66,7 +66,7 @@ inline iVector3<T> operator -(const iVector3<T>& left)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right)
+constexpr iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right)
 {
     left.x += right.x;
     left.y += right.y;
@@ -78,7 +78,7 @@ inline iVector3<T>& operator +=(iVector3<T>& left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right)
+constexpr iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right)
 {
     left.x -= right.x;
     left.y -= right.y;
@@ -90,7 +90,7 @@ inline iVector3<T>& operator -=(iVector3<T>& left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right)
+constexpr iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right)
 {
     return iVector3<T>(left.x + right.x, left.y + right.y, left.z + right.z);
 }
@@ -98,7 +98,7 @@ inline iVector3<T> operator +(const iVector3<T>& left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right)
+constexpr iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right)
 {
     return iVector3<T>(left.x - right.x, left.y - right.y, left.z - right.z);
 }
@@ -106,7 +106,7 @@ inline iVector3<T> operator -(const iVector3<T>& left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator *(const iVector3<T>& left, T right)
+constexpr iVector3<T> operator *(const iVector3<T>& left, T right)
 {
     return iVector3<T>(left.x * right, left.y * right, left.z * right);
 }
@@ -114,7 +114,7 @@ inline iVector3<T> operator *(const iVector3<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator *(T left, const iVector3<T>& right)
+constexpr iVector3<T> operator *(T left, const iVector3<T>& right)
 {
     return iVector3<T>(right.x * left, right.y * left, right.z * left);
 }
@@ -122,7 +122,7 @@ inline iVector3<T> operator *(T left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>& operator *=(iVector3<T>& left, T right)
+constexpr iVector3<T>& operator *=(iVector3<T>& left, T right)
 {
     left.x *= right;
     left.y *= right;
@@ -134,7 +134,7 @@ inline iVector3<T>& operator *=(iVector3<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T> operator /(const iVector3<T>& left, T right)
+constexpr iVector3<T> operator /(const iVector3<T>& left, T right)
 {
     return iVector3<T>(left.x / right, left.y / right, left.z / right);
 }
@@ -142,7 +142,7 @@ inline iVector3<T> operator /(const iVector3<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline iVector3<T>& operator /=(iVector3<T>& left, T right)
+constexpr iVector3<T>& operator /=(iVector3<T>& left, T right)
 {
     left.x /= right;
     left.y /= right;
@@ -154,7 +154,7 @@ inline iVector3<T>& operator /=(iVector3<T>& left, T right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline bool operator ==(const iVector3<T>& left, const iVector3<T>& right)
+constexpr bool operator ==(const iVector3<T>& left, const iVector3<T>& right)
 {
     return (left.x == right.x) && (left.y == right.y) && (left.z == right.z);
 }
@@ -162,7 +162,7 @@ inline bool operator ==(const iVector3<T>& left, const iVector3<T>& right)
 
 ////////////////////////////////////////////////////////////
 template <typename T>
-inline bool operator !=(const iVector3<T>& left, const iVector3<T>& right)
+constexpr bool operator !=(const iVector3<T>& left, const iVector3<T>& right)
 {
     return (left.x != right.x) || (left.y != right.y) || (left.z != right.z);
 }
@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
+#include "CacheState.hpp"
 #include "Vertex.hpp"
 #include "PrimitiveType.hpp"
 #include "Rect.hpp"
@@ -80,6 +81,10 @@ public:
     ///
     /// \param index Index of the vertex to get
     ///
+    /// Calling this function invalidates the cached bounds, so
+    /// the reference must not be kept to modify the vertex after
+    /// the next call to getBounds().
+    ///
     /// \return Reference to the index-th vertex
     ///
     /// \see getVertexCount
@@ -166,11 +171,16 @@ public:
     /// This function returns the minimal axis-aligned rectangle
     /// that contains all the vertices of the array.
     ///
+    /// The bounds are cached until the array is modified with
+    /// operator[], clear(), resize() or append().
+    ///
     /// \return Bounding rectangle of the vertex array
     ///
     ////////////////////////////////////////////////////////////
     FloatRect getBounds() const;
 
+private:
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex array to a render target
     ///
@@ -178,9 +188,7 @@ public:
     /// \param states Current render states
     ///
     ////////////////////////////////////////////////////////////
-    virtual void draw() const;
-
-
+    virtual void draw(RenderTarget& target, RenderStates states) const;
 
 private:
 
@@ -189,6 +197,8 @@ private:
     ////////////////////////////////////////////////////////////
     std::vector<Vertex> m_vertices;      ///< Vertices contained in the array
     PrimitiveType       m_primitiveType; ///< Type of primitives to draw
+    mutable FloatRect   m_bounds;        ///< Cached bounding rectangle of the vertices
+    priv::CacheState    m_boundsState;   ///< Are the bounds up to date?
 };
 
 } // namespace sf
@@ -215,9 +225,13 @@ private:
 /// lines[2].position = sf::iVector2f(30, 5);
 /// lines[3].position = sf::iVector2f(40, 2);
 ///
-/// window.draw(lines);
+/// target.draw(lines);
 /// \endcode
 ///
+/// The bounds returned by getBounds() are cached, and computed
+/// with SSE2 when it is available; arrays of several hundred
+/// thousand vertices are split among the threads of the library.
+///
 /// \see sf::Vertex
 ///
 ////////////////////////////////////////////////////////////
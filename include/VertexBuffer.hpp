@@ -0,0 +1,406 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_VERTEXBUFFER_HPP
+#define SFML_VERTEXBUFFER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Export.hpp"
+#include "Drawable.hpp"
+#include "PrimitiveType.hpp"
+#include "Vertex.hpp"
+#include "Vector2.hpp"
+#include <vector>
+
+
+namespace sf
+{
+class VertexArray;
+
+////////////////////////////////////////////////////////////
+/// \brief Vertex buffer storage for one or more 2D primitives
+///
+////////////////////////////////////////////////////////////
+class  VertexBuffer : public Drawable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// If data is going to be updated once or more every frame,
+    /// set the usage to Stream. If data is going to be set once
+    /// and used for a long time without being modified, set the
+    /// usage to Static. For everything else Dynamic should be a
+    /// good compromise.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Usage
+    {
+        Stream,  ///< Constantly changing data
+        Dynamic, ///< Occasionally changing data
+        Static   ///< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty vertex buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a VertexBuffer with a specific PrimitiveType
+    ///
+    /// \param type Type of primitive
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit VertexBuffer(PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a VertexBuffer with a specific usage specifier
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit VertexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a VertexBuffer with a specific PrimitiveType and usage specifier
+    ///
+    /// \param type  Type of primitive
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexBuffer(PrimitiveType type, Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// The copy owns its own GPU buffer, which is uploaded the
+    /// first time the copy is drawn.
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexBuffer(const VertexBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~VertexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexBuffer& operator =(const VertexBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the vertex buffer
+    ///
+    /// Allocates enough storage for \a vertexCount vertices.
+    /// The content of the buffer is reset to default vertices.
+    ///
+    /// \param vertexCount Number of vertices worth of memory to allocate
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the vertex count
+    ///
+    /// \return Number of vertices in the vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of vertices
+    ///
+    /// \a vertices must contain at least getVertexCount() vertices.
+    ///
+    /// \param vertices Array of vertices to copy to the buffer
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(const Vertex* vertices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of vertices
+    ///
+    /// \a offset is specified as the number of vertices to skip
+    /// from the beginning of the buffer. If \a offset + \a vertexCount
+    /// is greater than the current size of the buffer, the buffer
+    /// grows to hold the new vertices.
+    ///
+    /// Only the modified range is sent to the GPU, the next time
+    /// the buffer is drawn.
+    ///
+    /// \param vertices    Array of vertices to copy to the buffer
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(const Vertex* vertices, std::size_t vertexCount, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from a vertex array
+    ///
+    /// The buffer is resized to the size of the array.
+    ///
+    /// \param vertices Vertex array to copy to the buffer
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(const VertexArray& vertices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a range of the buffer from the same range of a vertex array
+    ///
+    /// This is meant to be used together with update(const VertexArray&):
+    /// after modifying a few vertices of the source array, only
+    /// the [offset, offset + count) range is copied and uploaded.
+    ///
+    /// \param vertices Source vertex array
+    /// \param offset   Index of the first vertex to copy
+    /// \param count    Number of vertices to copy
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(const VertexArray& vertices, std::size_t offset, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the type of primitives to draw
+    ///
+    /// \param type Type of primitive
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPrimitiveType(PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of primitives drawn by the vertex buffer
+    ///
+    /// \return Primitive type
+    ///
+    ////////////////////////////////////////////////////////////
+    PrimitiveType getPrimitiveType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this vertex buffer
+    ///
+    /// The new usage takes effect the next time the GPU buffer
+    /// is (re)allocated.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this vertex buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports vertex buffers
+    ///
+    /// When vertex buffers are not supported, drawing falls back
+    /// to streaming the vertices through the rlgl batch.
+    ///
+    /// \return True if vertex buffers are supported
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+
+    friend class RlglRenderTarget;
+    friend class HeadlessRenderTarget;
+    friend class SoftwareRenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the vertex buffer to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark a range of vertices as modified
+    ///
+    /// \param first First modified vertex
+    /// \param last  One past the last modified vertex
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(std::size_t first, std::size_t last);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the range of vertices modified since a revision
+    ///
+    /// This is meant for render targets that keep their own copy
+    /// of the buffer, and remember the revision they last copied.
+    /// If the changes since \a revision are no longer known, the
+    /// whole buffer is reported.
+    ///
+    /// \param revision Revision of the buffer, as seen by the caller
+    /// \param first    Receives the first modified vertex
+    /// \param last     Receives one past the last modified vertex
+    ///
+    ////////////////////////////////////////////////////////////
+    void getChangedRange(Uint64 revision, std::size_t& first, std::size_t& last) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the GPU buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void destroy();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the modified range of vertices to the GPU
+    ///
+    /// \param texCoordScale Factors converting the texture coordinates
+    ///                      from pixels to normalized coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload(const iVector2f& texCoordScale) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the buffer with rlgl, uploading it first if needed
+    ///
+    /// This is meant to be called by sf::RlglRenderTarget only.
+    ///
+    /// \param transform     Transform to apply to the vertices
+    /// \param texture       Identifier of the texture to bind
+    /// \param texCoordScale Factors converting the texture coordinates
+    ///                      from pixels to normalized coordinates
+    ///
+    /// \return False if the buffer can't be drawn from the GPU, in
+    ///         which case its vertices must be streamed instead
+    ///
+    ////////////////////////////////////////////////////////////
+    bool render(const Transform& transform, unsigned int texture, const iVector2f& texCoordScale) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Modified range of vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Change
+    {
+        Uint64      revision; ///< Revision of the buffer after the change
+        std::size_t first;    ///< First modified vertex
+        std::size_t last;     ///< One past the last modified vertex
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vertex>         m_vertices;      ///< CPU copy of the vertices, as given by the user
+    mutable std::vector<Vertex> m_triangles;     ///< Vertices expanded to a triangle list, for strips, fans and quads
+    PrimitiveType               m_primitiveType; ///< Type of primitives to draw
+    Usage                       m_usage;         ///< How this vertex buffer is to be used
+    mutable std::size_t         m_dirtyBegin;    ///< First vertex not uploaded yet
+    mutable std::size_t         m_dirtyEnd;      ///< One past the last vertex not uploaded yet
+    Uint64                      m_revision;      ///< Revision of the content, unique among all the buffers
+    Uint64                      m_historyStart;  ///< Revision before the oldest change of m_changes
+    std::vector<Change>         m_changes;       ///< Latest changes, oldest first
+    mutable std::size_t         m_gpuCapacity;   ///< Number of vertices the GPU buffer can hold
+    mutable iVector2f           m_texCoordScale; ///< Texture coordinates scale of the uploaded vertices
+    mutable unsigned int        m_vao;           ///< Vertex array object identifier
+    mutable unsigned int        m_vbo;           ///< Vertex buffer object identifier
+};
+
+} // namespace sf
+
+
+#endif // SFML_VERTEXBUFFER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::VertexBuffer
+/// \ingroup graphics
+///
+/// sf::VertexBuffer is a simple wrapper around a GPU vertex
+/// buffer. Unlike sf::VertexArray, whose vertices are streamed
+/// through the rlgl batch every time it is drawn, the vertices
+/// of a sf::VertexBuffer are uploaded once and redrawn with a
+/// single draw call. It is meant for geometry that rarely
+/// changes, such as tile maps or static scenery.
+///
+/// The buffer keeps a copy of its vertices in system memory.
+/// Updates only touch this copy and record the modified range;
+/// every render target uploads what changed since it last drew
+/// the buffer. The GPU copy belongs to the buffer itself, so the
+/// rlgl targets share it and upload the pending range once;
+/// targets without a GPU, such as sf::HeadlessRenderTarget,
+/// remember the revision of the buffer they last saw instead.
+/// A buffer can thus be drawn to any mix of render targets.
+///
+/// rlgl only exposes triangle draws for vertex arrays, so
+/// triangle strips, fans and quads are expanded to a triangle
+/// list when they are uploaded. Points, Lines and LineStrip
+/// buffers are drawn through the rlgl batch instead.
+///
+/// The usage specifier is a hint given to the driver; rlgl only
+/// distinguishes static and dynamic buffers, so Stream buffers
+/// are allocated as dynamic ones.
+///
+/// Example:
+/// \code
+/// sf::VertexArray tiles(sf::Quads, width * height * 4);
+/// ... // fill the tiles
+///
+/// sf::VertexBuffer buffer(sf::Quads, sf::VertexBuffer::Static);
+/// buffer.update(tiles);
+///
+/// // change a single tile
+/// tiles[index * 4].color = sf::iColor::Red;
+/// buffer.update(tiles, index * 4, 4);
+///
+/// target.draw(buffer, &tileset);
+/// \endcode
+///
+/// \see sf::VertexArray
+///
+////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Export.hpp"
+#include "CacheState.hpp"
 #include "Rect.hpp"
 #include "Transform.hpp"
 #include "Vector2.hpp"
@@ -243,7 +244,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Get the projection transform of the view
     ///
-    /// This function is meant for internal use only.
+    /// This function is meant for internal use only. It can be
+    /// called from several threads at once, as long as none of
+    /// them modifies the view.
     ///
     /// \return Projection transform defining the view
     ///
@@ -269,14 +272,14 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    iVector2f          m_center;              ///< Center of the view, in scene coordinates
-    iVector2f          m_size;                ///< Size of the view, in scene coordinates
-    float             m_rotation;            ///< Angle of rotation of the view rectangle, in degrees
-    FloatRect         m_viewport;            ///< Viewport rectangle, expressed as a factor of the render-target's size
-    mutable Transform m_transform;           ///< Precomputed projection transform corresponding to the view
-    mutable Transform m_inverseTransform;    ///< Precomputed inverse projection transform corresponding to the view
-    mutable bool      m_transformUpdated;    ///< Internal state telling if the transform needs to be updated
-    mutable bool      m_invTransformUpdated; ///< Internal state telling if the inverse transform needs to be updated
+    iVector2f         m_center;            ///< Center of the view, in scene coordinates
+    iVector2f         m_size;              ///< Size of the view, in scene coordinates
+    float             m_rotation;          ///< Angle of rotation of the view rectangle, in degrees
+    FloatRect         m_viewport;          ///< Viewport rectangle, expressed as a factor of the render-target's size
+    mutable Transform m_transform;         ///< Precomputed projection transform corresponding to the view
+    mutable Transform m_inverseTransform;  ///< Precomputed inverse projection transform corresponding to the view
+    priv::CacheState  m_transformState;    ///< Internal state telling if the transform needs to be updated
+    priv::CacheState  m_invTransformState; ///< Internal state telling if the inverse transform needs to be updated
 };
 
 } // namespace sf
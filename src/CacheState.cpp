@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "CacheState.hpp"
+#include <thread>
+
+
+namespace
+{
+    // States of the cached value
+    enum
+    {
+        Stale,
+        Computing,
+        Published
+    };
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+CacheState::CacheState() :
+m_state(Stale)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+CacheState::CacheState(const CacheState& copy) :
+m_state(copy.isValid() ? Published : Stale)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+CacheState& CacheState::operator =(const CacheState& right)
+{
+    m_state.store(right.isValid() ? Published : Stale, std::memory_order_relaxed);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void CacheState::invalidate()
+{
+    // Writers have exclusive access, so no ordering is needed here
+    m_state.store(Stale, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool CacheState::isValid() const
+{
+    return m_state.load(std::memory_order_acquire) == Published;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CacheState::beginUpdate() const
+{
+    for (;;)
+    {
+        int state = m_state.load(std::memory_order_acquire);
+        if (state == Published)
+            return false;
+
+        if ((state == Stale) && m_state.compare_exchange_weak(state, Computing, std::memory_order_acquire))
+            return true;
+
+        // Another thread is computing the value: computations are short, so just yield
+        std::this_thread::yield();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CacheState::endUpdate() const
+{
+    m_state.store(Published, std::memory_order_release);
+}
+
+} // namespace priv
+
+} // namespace sf
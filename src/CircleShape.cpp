@@ -26,7 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "CircleShape.hpp"
-#include <cmath>
+#include "UnitCircle.hpp"
 
 
 namespace sf
@@ -34,7 +34,8 @@ namespace sf
 ////////////////////////////////////////////////////////////
 CircleShape::CircleShape(float radius, std::size_t pointCount) :
 m_radius    (radius),
-m_pointCount(pointCount)
+m_pointCount(pointCount),
+m_unitPoints(priv::getUnitCircle(pointCount))
 {
     update();
 }
@@ -59,6 +60,7 @@ float CircleShape::getRadius() const
 void CircleShape::setPointCount(std::size_t count)
 {
     m_pointCount = count;
+    m_unitPoints = priv::getUnitCircle(count);
     update();
 }
 
@@ -72,13 +74,9 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 iVector2f CircleShape::getPoint(std::size_t index) const
 {
-    static const float pi = 3.141592654f;
+    const iVector2f& point = m_unitPoints[index];
 
-    float angle = index * 2 * pi / m_pointCount - pi / 2;
-    float x = std::cos(angle) * m_radius;
-    float y = std::sin(angle) * m_radius;
-
-    return iVector2f(m_radius + x, m_radius + y);
+    return iVector2f(m_radius + point.x * m_radius, m_radius + point.y * m_radius);
 }
 
 } // namespace sf
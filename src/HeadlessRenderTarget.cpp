@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "HeadlessRenderTarget.hpp"
+#include "VertexBuffer.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+HeadlessRenderTarget::HeadlessRenderTarget(unsigned int width, unsigned int height) :
+m_size           (width, height),
+m_vertices       (),
+m_drawCalls      (),
+m_stateChanges   (),
+m_uploads        (),
+m_bufferRevisions(),
+m_instances      (),
+m_frameCount     (0),
+m_hasState       (false),
+m_viewChanged    (true),
+m_texture        (0),
+m_transform      (),
+m_blendMode      ()
+{
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2u HeadlessRenderTarget::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::clear()
+{
+    m_vertices.clear();
+    m_drawCalls.clear();
+    m_stateChanges.clear();
+    m_uploads.clear();
+    m_instances.clear();
+    m_frameCount = 0;
+    m_hasState   = false;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Vertex>& HeadlessRenderTarget::getVertices() const
+{
+    return m_vertices;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<HeadlessRenderTarget::DrawCall>& HeadlessRenderTarget::getDrawCalls() const
+{
+    return m_drawCalls;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<HeadlessRenderTarget::StateChange>& HeadlessRenderTarget::getStateChanges() const
+{
+    return m_stateChanges;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<HeadlessRenderTarget::Upload>& HeadlessRenderTarget::getUploads() const
+{
+    return m_uploads;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<SpriteInstance>& HeadlessRenderTarget::getInstances() const
+{
+    return m_instances;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t HeadlessRenderTarget::getFrameCount() const
+{
+    return m_frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::onDisplay()
+{
+    ++m_frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::onViewChanged()
+{
+    m_viewChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                          PrimitiveType type, const RenderStates& states)
+{
+    record(vertices, vertexCount, type, states, false, false);
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    // Like a GPU, the target keeps its own copy of every buffer: record the
+    // vertices changed since it last saw the buffer, or all of them the first time
+    std::map<const VertexBuffer*, Uint64>::iterator seen = m_bufferRevisions.find(&vertexBuffer);
+    if ((seen == m_bufferRevisions.end()) || (seen->second != vertexBuffer.m_revision))
+    {
+        std::size_t first = 0;
+        std::size_t last  = vertexBuffer.m_vertices.size();
+        if (seen != m_bufferRevisions.end())
+            vertexBuffer.getChangedRange(seen->second, first, last);
+
+        if (first < last)
+        {
+            Upload upload = {&vertexBuffer, first, last - first};
+            m_uploads.push_back(upload);
+        }
+
+        m_bufferRevisions[&vertexBuffer] = vertexBuffer.m_revision;
+    }
+
+    record(&vertexBuffer.m_vertices[0], vertexBuffer.m_vertices.size(), vertexBuffer.m_primitiveType, states, true, false);
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                                         std::size_t instanceCount, const RenderStates& states)
+{
+    record(quad, 4, Quads, states, false, true);
+
+    DrawCall& drawCall = m_drawCalls.back();
+    drawCall.firstInstance = m_instances.size();
+    drawCall.instanceCount = instanceCount;
+
+    m_instances.insert(m_instances.end(), instances, instances + instanceCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void HeadlessRenderTarget::record(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type,
+                                  const RenderStates& states, bool buffered, bool instanced)
+{
+    unsigned int texture = (states.texture && (states.texture->id > 0)) ? states.texture->id : 0;
+
+    // Record the state changes, compared to the previous draw call
+    if (!m_hasState || (texture != m_texture))
+    {
+        StateChange change = {StateChange::TextureChange, m_drawCalls.size()};
+        m_stateChanges.push_back(change);
+        m_texture = texture;
+        ++getCurrentStats().textureBinds;
+    }
+
+    if (!m_hasState || (states.transform != m_transform))
+    {
+        StateChange change = {StateChange::TransformChange, m_drawCalls.size()};
+        m_stateChanges.push_back(change);
+        m_transform = states.transform;
+    }
+
+    if (!m_hasState || (states.blendMode != m_blendMode))
+    {
+        StateChange change = {StateChange::BlendModeChange, m_drawCalls.size()};
+        m_stateChanges.push_back(change);
+        m_blendMode = states.blendMode;
+        ++getCurrentStats().blendModeChanges;
+    }
+
+    if (!m_hasState || m_viewChanged)
+    {
+        StateChange change = {StateChange::ViewChange, m_drawCalls.size()};
+        m_stateChanges.push_back(change);
+        m_viewChanged = false;
+        ++getCurrentStats().viewChanges;
+    }
+
+    m_hasState = true;
+
+    if (states.transform != Transform::Identity)
+        ++getCurrentStats().matrixPushes;
+
+    // Record the draw call and its vertices
+    DrawCall drawCall = {type, m_vertices.size(), vertexCount, texture, states.blendMode, buffered, 0, 0};
+    m_drawCalls.push_back(drawCall);
+
+    // The quad of an instanced draw is transformed by each instance first,
+    // so it can only be recorded in local coordinates
+    if (instanced)
+    {
+        m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+        return;
+    }
+
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        Vertex vertex = vertices[i];
+        vertex.position = states.transform.transformPoint(vertex.position);
+        m_vertices.push_back(vertex);
+    }
+}
+
+} // namespace sf
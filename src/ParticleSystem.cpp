@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "ParticleSystem.hpp"
+#include "RenderTarget.hpp"
+#include "ThreadPool.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_PARTICLES_SSE2
+#endif
+
+
+namespace
+{
+    // Number of particles updated by one task
+    const std::size_t chunkSize = 16384;
+
+    // Next number of a xorshift32 generator
+    inline sf::Uint32 nextRandom(sf::Uint32& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // Random number in [0, 1)
+    inline float randomUnit(sf::Uint32& state)
+    {
+        return (nextRandom(state) >> 8) * (1.f / 16777216.f);
+    }
+
+    // Opacity of a particle, from its remaining lifetime
+    inline sf::Uint8 getAlpha(float lifetime, float fade)
+    {
+        return static_cast<sf::Uint8>(std::min(std::max(lifetime * fade, 0.f), 255.f));
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(std::size_t count, PrimitiveType type, unsigned int threadCount) :
+m_positionsX  (count, 0.f),
+m_positionsY  (count, 0.f),
+m_velocitiesX (count, 0.f),
+m_velocitiesY (count, 0.f),
+m_lifetimes   (count, 0.f),
+m_randomStates((count + chunkSize - 1) / chunkSize),
+m_vertices    (),
+m_type        ((type == Quads) ? Quads : Points),
+m_emitter     (0.f, 0.f),
+m_minLifetime (1.f),
+m_maxLifetime (3.f),
+m_minSpeed    (50.f),
+m_maxSpeed    (100.f),
+m_color       (iColor::White),
+m_size        (2.f),
+m_threadPool  ((threadCount > 0) ? new priv::ThreadPool(threadCount) : &priv::ThreadPool::getShared())
+{
+    m_vertices.resize((m_type == Quads) ? count * 4 : count);
+
+    // Distinct, non-zero seeds for the chunk generators
+    for (std::size_t i = 0; i < m_randomStates.size(); ++i)
+        m_randomStates[i] = static_cast<Uint32>(i + 1) * 2654435761u;
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::~ParticleSystem()
+{
+    if (!m_threadPool->isShared())
+        delete m_threadPool;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setEmitter(const iVector2f& position)
+{
+    m_emitter = position;
+}
+
+
+////////////////////////////////////////////////////////////
+const iVector2f& ParticleSystem::getEmitter() const
+{
+    return m_emitter;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setLifetime(Time minimum, Time maximum)
+{
+    m_minLifetime = minimum.asSeconds();
+    m_maxLifetime = std::max(maximum.asSeconds(), m_minLifetime);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setSpeed(float minimum, float maximum)
+{
+    m_minSpeed = minimum;
+    m_maxSpeed = std::max(maximum, minimum);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setColor(const iColor& color)
+{
+    m_color = color;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setParticleSize(float size)
+{
+    m_size = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_lifetimes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    SFML_PROFILE_SCOPE("ParticleSystem::update");
+
+    float seconds = elapsed.asSeconds();
+    m_threadPool->run(m_randomStates.size(), [this, seconds](std::size_t chunk) { updateChunk(chunk, seconds); });
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_vertices.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture = NULL;
+
+    target.draw(&m_vertices[0], m_vertices.size(), m_type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateChunk(std::size_t chunk, float seconds)
+{
+    std::size_t begin = chunk * chunkSize;
+    std::size_t end   = std::min(begin + chunkSize, m_lifetimes.size());
+
+    float* x    = &m_positionsX[0];
+    float* y    = &m_positionsY[0];
+    float* vx   = &m_velocitiesX[0];
+    float* vy   = &m_velocitiesY[0];
+    float* life = &m_lifetimes[0];
+    float  fade = (m_maxLifetime > 0.f) ? 255.f / m_maxLifetime : 0.f;
+
+    // Integrate: move and age the particles
+    std::size_t i = begin;
+
+#ifdef SFML_PARTICLES_SSE2
+    __m128 dt = _mm_set1_ps(seconds);
+    for (; i + 4 <= end; i += 4)
+    {
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        x[i] += vx[i] * seconds;
+        y[i] += vy[i] * seconds;
+        life[i] -= seconds;
+    }
+
+    // Spawn the dead particles again
+    Uint32& state = m_randomStates[chunk];
+    for (i = begin; i < end; ++i)
+    {
+        if (life[i] <= 0.f)
+            respawn(i, state);
+    }
+
+    // Fade the particles and write their vertices
+    Uint8 alphas[4];
+    for (i = begin; i < end; i += 4)
+    {
+        std::size_t count = std::min<std::size_t>(4, end - i);
+
+#ifdef SFML_PARTICLES_SSE2
+        if (count == 4)
+        {
+            __m128 alpha = _mm_mul_ps(_mm_loadu_ps(life + i), _mm_set1_ps(fade));
+            alpha = _mm_min_ps(_mm_max_ps(alpha, _mm_setzero_ps()), _mm_set1_ps(255.f));
+
+            // Pack the four 32-bit integers down to bytes
+            __m128i bytes = _mm_cvttps_epi32(alpha);
+            bytes = _mm_packs_epi32(bytes, bytes);
+            bytes = _mm_packus_epi16(bytes, bytes);
+
+            int packed = _mm_cvtsi128_si32(bytes);
+            for (int k = 0; k < 4; ++k)
+                alphas[k] = static_cast<Uint8>(packed >> (k * 8));
+        }
+        else
+#endif
+        {
+            for (std::size_t k = 0; k < count; ++k)
+                alphas[k] = getAlpha(life[i + k], fade);
+        }
+
+        iColor color = m_color;
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            std::size_t index = i + k;
+            color.a = alphas[k];
+
+            if (m_type == Quads)
+            {
+                float left   = x[index] - m_size / 2.f;
+                float top    = y[index] - m_size / 2.f;
+                float right  = left + m_size;
+                float bottom = top + m_size;
+
+                Vertex* quad = &m_vertices[index * 4];
+                quad[0].position = iVector2f(left, top);
+                quad[1].position = iVector2f(right, top);
+                quad[2].position = iVector2f(right, bottom);
+                quad[3].position = iVector2f(left, bottom);
+                quad[0].color = quad[1].color = quad[2].color = quad[3].color = color;
+            }
+            else
+            {
+                m_vertices[index].position = iVector2f(x[index], y[index]);
+                m_vertices[index].color    = color;
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::respawn(std::size_t index, Uint32& state)
+{
+    // Give a random velocity and lifetime to the particle
+    float angle = randomUnit(state) * 2.f * 3.141592654f;
+    float speed = m_minSpeed + randomUnit(state) * (m_maxSpeed - m_minSpeed);
+
+    m_positionsX[index]  = m_emitter.x;
+    m_positionsY[index]  = m_emitter.y;
+    m_velocitiesX[index] = std::cos(angle) * speed;
+    m_velocitiesY[index] = std::sin(angle) * speed;
+    m_lifetimes[index]   = m_minLifetime + randomUnit(state) * (m_maxLifetime - m_minLifetime);
+}
+
+} // namespace sf
@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Profiler.hpp"
+#include "Clock.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+
+namespace
+{
+    // Scope recorded by a thread
+    struct Event
+    {
+        const char*  name;
+        sf::Int64    start;
+        sf::Int64    end;
+        unsigned int thread;
+    };
+
+    // Single-producer single-consumer ring of events: the owning thread
+    // pushes, the thread calling endFrame drains
+    class EventRing
+    {
+    public:
+
+        enum {Capacity = 1 << 14};
+
+        explicit EventRing(unsigned int thread) :
+        m_thread    (thread),
+        m_events    (Capacity),
+        m_writeIndex(0),
+        m_readIndex (0)
+        {
+        }
+
+        bool push(const char* name, sf::Int64 start, sf::Int64 end)
+        {
+            std::size_t write = m_writeIndex.load(std::memory_order_relaxed);
+            if (write - m_readIndex.load(std::memory_order_acquire) >= Capacity)
+                return false;
+
+            Event& event = m_events[write & (Capacity - 1)];
+            event.name   = name;
+            event.start  = start;
+            event.end    = end;
+            event.thread = m_thread;
+
+            m_writeIndex.store(write + 1, std::memory_order_release);
+            return true;
+        }
+
+        void drain(std::vector<Event>& events)
+        {
+            std::size_t read  = m_readIndex.load(std::memory_order_relaxed);
+            std::size_t write = m_writeIndex.load(std::memory_order_acquire);
+
+            for (; read != write; ++read)
+                events.push_back(m_events[read & (Capacity - 1)]);
+
+            m_readIndex.store(write, std::memory_order_release);
+        }
+
+    private:
+
+        unsigned int             m_thread;
+        std::vector<Event>       m_events;
+        std::atomic<std::size_t> m_writeIndex;
+        std::atomic<std::size_t> m_readIndex;
+    };
+
+    // Maximum number of events kept for the Chrome trace
+    const std::size_t maxTraceEvents = 1 << 20;
+
+    // State shared by all the threads
+    struct ProfilerState
+    {
+        ProfilerState() :
+        dropped(0)
+        {
+        }
+
+        ~ProfilerState()
+        {
+            for (std::size_t i = 0; i < rings.size(); ++i)
+                delete rings[i];
+        }
+
+        sf::Clock                               epoch;       // Origin of the timestamps
+        std::mutex                              mutex;       // Protects the list of rings
+        std::vector<EventRing*>                 rings;       // Ring of every thread that recorded a scope
+        std::atomic<std::size_t>                dropped;     // Number of scopes that could not be recorded
+        std::vector<Event>                      frameEvents; // Scopes of the last frame
+        std::vector<Event>                      trace;       // Scopes kept for the Chrome trace
+        std::vector<sf::Profiler::ScopeSummary> summary;     // Summary of the last frame
+    };
+
+    ProfilerState& getState()
+    {
+        static ProfilerState state;
+        return state;
+    }
+
+    // Get the ring of the calling thread, creating it on first use
+    EventRing& getThreadRing()
+    {
+        thread_local EventRing* ring = NULL;
+
+        if (!ring)
+        {
+            ProfilerState& state = getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+
+            ring = new EventRing(static_cast<unsigned int>(state.rings.size()));
+            state.rings.push_back(ring);
+        }
+
+        return *ring;
+    }
+
+    // Order events by name, then by duration
+    bool compareEvents(const Event& left, const Event& right)
+    {
+        int order = std::strcmp(left.name, right.name);
+        if (order != 0)
+            return order < 0;
+
+        return (left.end - left.start) < (right.end - right.start);
+    }
+
+    // Order summaries by decreasing total time
+    bool compareSummaries(const sf::Profiler::ScopeSummary& left, const sf::Profiler::ScopeSummary& right)
+    {
+        return left.total > right.total;
+    }
+
+    // Write a string as a JSON string literal
+    void writeJsonString(std::FILE* file, const char* string)
+    {
+        std::fputc('"', file);
+        for (; *string; ++string)
+        {
+            if ((*string == '"') || (*string == '\\'))
+                std::fputc('\\', file);
+            std::fputc(*string, file);
+        }
+        std::fputc('"', file);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void Profiler::endFrame()
+{
+    ProfilerState& state = getState();
+
+    // Collect the events of every thread
+    state.frameEvents.clear();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (std::size_t i = 0; i < state.rings.size(); ++i)
+            state.rings[i]->drain(state.frameEvents);
+    }
+
+    // Keep them for the trace, as long as there is room
+    std::size_t room = maxTraceEvents - state.trace.size();
+    std::size_t kept = std::min(room, state.frameEvents.size());
+    state.trace.insert(state.trace.end(), state.frameEvents.begin(), state.frameEvents.begin() + kept);
+    state.dropped += state.frameEvents.size() - kept;
+
+    // Summarize them, scope by scope
+    std::sort(state.frameEvents.begin(), state.frameEvents.end(), compareEvents);
+
+    state.summary.clear();
+    for (std::size_t first = 0; first < state.frameEvents.size();)
+    {
+        std::size_t last = first + 1;
+        while ((last < state.frameEvents.size()) && (std::strcmp(state.frameEvents[last].name, state.frameEvents[first].name) == 0))
+            ++last;
+
+        // The events of a scope are sorted by duration
+        const Event* events = &state.frameEvents[first];
+        std::size_t  count  = last - first;
+
+        Int64 total = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            total += events[i].end - events[i].start;
+
+        const Event& p50 = events[(count - 1) * 50 / 100];
+        const Event& p99 = events[(count - 1) * 99 / 100];
+
+        ScopeSummary summary = {events[0].name, count, microseconds(total),
+                                microseconds(p50.end - p50.start), microseconds(p99.end - p99.start)};
+        state.summary.push_back(summary);
+
+        first = last;
+    }
+
+    std::sort(state.summary.begin(), state.summary.end(), compareSummaries);
+}
+
+
+////////////////////////////////////////////////////////////
+const std::vector<Profiler::ScopeSummary>& Profiler::getFrameSummary()
+{
+    return getState().summary;
+}
+
+
+////////////////////////////////////////////////////////////
+void Profiler::printFrameSummary()
+{
+    const std::vector<ScopeSummary>& summary = getFrameSummary();
+
+    std::printf("%-40s %8s %12s %10s %10s\n", "scope", "count", "total (us)", "p50 (us)", "p99 (us)");
+    for (std::size_t i = 0; i < summary.size(); ++i)
+    {
+        std::printf("%-40s %8lu %12lld %10lld %10lld\n", summary[i].name,
+                    static_cast<unsigned long>(summary[i].count),
+                    static_cast<long long>(summary[i].total.asMicroseconds()),
+                    static_cast<long long>(summary[i].p50.asMicroseconds()),
+                    static_cast<long long>(summary[i].p99.asMicroseconds()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Profiler::writeChromeTrace(const std::string& filename)
+{
+    std::FILE* file = std::fopen(filename.c_str(), "w");
+    if (!file)
+        return false;
+
+    const std::vector<Event>& trace = getState().trace;
+
+    // Complete ("X") events, with timestamps and durations in microseconds
+    std::fputs("{\"traceEvents\":[\n", file);
+    for (std::size_t i = 0; i < trace.size(); ++i)
+    {
+        std::fputs("{\"name\":", file);
+        writeJsonString(file, trace[i].name);
+        std::fprintf(file, ",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}%s\n",
+                     static_cast<long long>(trace[i].start),
+                     static_cast<long long>(trace[i].end - trace[i].start),
+                     trace[i].thread,
+                     (i + 1 < trace.size()) ? "," : "");
+    }
+    std::fputs("],\"displayTimeUnit\":\"ms\"}\n", file);
+
+    return std::fclose(file) == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Profiler::clearTrace()
+{
+    getState().trace.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Profiler::getDroppedCount()
+{
+    return getState().dropped;
+}
+
+
+////////////////////////////////////////////////////////////
+ProfileScope::ProfileScope(const char* name) :
+m_name (name),
+m_start(getState().epoch.getElapsedTime().asMicroseconds())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ProfileScope::~ProfileScope()
+{
+    Int64 end = getState().epoch.getElapsedTime().asMicroseconds();
+
+    if (!getThreadRing().push(m_name, m_start, end))
+        ++getState().dropped;
+}
+
+} // namespace sf
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "RenderStates.hpp"
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+// We cannot use the default constructor here, because it accesses BlendAlpha and Transform::Identity, which are global variables
+const RenderStates RenderStates::Default(BlendMode(BlendMode::SrcAlpha, BlendMode::OneMinusSrcAlpha, BlendMode::Add,
+                                                   BlendMode::One, BlendMode::OneMinusSrcAlpha, BlendMode::Add),
+                                         Transform(1, 0, 0,
+                                                   0, 1, 0,
+                                                   0, 0, 1),
+                                         NULL);
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates() :
+blendMode(BlendAlpha),
+transform(),
+texture  (NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const BlendMode& theBlendMode) :
+blendMode(theBlendMode),
+transform(),
+texture  (NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const Transform& theTransform) :
+blendMode(BlendAlpha),
+transform(theTransform),
+texture  (NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const Texture2D* theTexture) :
+blendMode(BlendAlpha),
+transform(),
+texture  (theTexture)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const Transform& theTransform, const Texture2D* theTexture) :
+blendMode(BlendAlpha),
+transform(theTransform),
+texture  (theTexture)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStates::RenderStates(const BlendMode& theBlendMode, const Transform& theTransform, const Texture2D* theTexture) :
+blendMode(theBlendMode),
+transform(theTransform),
+texture  (theTexture)
+{
+}
+
+} // namespace sf
@@ -0,0 +1,349 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "RenderTarget.hpp"
+#include "Drawable.hpp"
+#include "SpriteInstance.hpp"
+#include "VertexBuffer.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace
+{
+    // Number of frames kept in the statistics history
+    const std::size_t statsHistorySize = 120;
+
+    // Number of primitives formed by a number of vertices
+    std::size_t getPrimitiveCount(sf::PrimitiveType type, std::size_t vertexCount)
+    {
+        switch (type)
+        {
+            case sf::Points:        return vertexCount;
+            case sf::Lines:         return vertexCount / 2;
+            case sf::LineStrip:     return (vertexCount > 1) ? vertexCount - 1 : 0;
+            case sf::Triangles:     return vertexCount / 3;
+            case sf::TriangleStrip:
+            case sf::TriangleFan:   return (vertexCount > 2) ? vertexCount - 2 : 0;
+            case sf::Quads:         return vertexCount / 4;
+        }
+
+        return 0;
+    }
+
+    // Count a draw in the statistics of the current frame
+    void countDraw(sf::RenderStats& stats, sf::PrimitiveType type, std::size_t vertexCount)
+    {
+        ++stats.drawCalls;
+        stats.vertexCount += vertexCount;
+        stats.primitives[type] += getPrimitiveCount(type, vertexCount);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() :
+m_defaultView     (),
+m_view            (),
+m_viewBounds      (),
+m_stats           (),
+m_statsHistory    (statsHistorySize),
+m_frameCount      (0),
+m_instanceVertices()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
+{
+    drawable.draw(*this, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
+                        PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    SFML_PROFILE_SCOPE("RenderTarget::draw");
+
+    countDraw(m_stats, type, vertexCount);
+    drawPrimitives(vertices, vertexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertexBuffer.getVertexCount() == 0)
+        return;
+
+    SFML_PROFILE_SCOPE("RenderTarget::draw");
+
+    countDraw(m_stats, vertexBuffer.getPrimitiveType(), vertexBuffer.getVertexCount());
+    drawBuffer(vertexBuffer, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const Texture2D& texture, const IntRect& textureRect, const SpriteInstance* instances,
+                                 std::size_t instanceCount, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!instances || (instanceCount == 0))
+        return;
+
+    SFML_PROFILE_SCOPE("RenderTarget::drawInstanced");
+
+    // The quad of a sprite showing the texture rectangle
+    float width  = static_cast<float>(std::abs(textureRect.width));
+    float height = static_cast<float>(std::abs(textureRect.height));
+    float left   = static_cast<float>(textureRect.left);
+    float right  = left + textureRect.width;
+    float top    = static_cast<float>(textureRect.top);
+    float bottom = top + textureRect.height;
+
+    Vertex quad[4] =
+    {
+        Vertex(iVector2f(0, 0),          iVector2f(left, top)),
+        Vertex(iVector2f(0, height),     iVector2f(left, bottom)),
+        Vertex(iVector2f(width, height), iVector2f(right, bottom)),
+        Vertex(iVector2f(width, 0),      iVector2f(right, top))
+    };
+
+    RenderStates instanceStates(states);
+    instanceStates.texture = (texture.id > 0) ? &texture : NULL;
+
+    countDraw(m_stats, Quads, instanceCount * 4);
+    m_stats.instanceCount += instanceCount;
+    drawInstances(quad, instances, instanceCount, instanceStates);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setView(const View& view)
+{
+    m_view = view;
+
+    // The visible area is the clip-space square brought back to the world
+    m_viewBounds = m_view.getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+
+    onViewChanged();
+}
+
+
+////////////////////////////////////////////////////////////
+const View& RenderTarget::getView() const
+{
+    return m_view;
+}
+
+
+////////////////////////////////////////////////////////////
+const View& RenderTarget::getDefaultView() const
+{
+    return m_defaultView;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect RenderTarget::getViewport(const View& view) const
+{
+    float width  = static_cast<float>(getSize().x);
+    float height = static_cast<float>(getSize().y);
+    const FloatRect& viewport = view.getViewport();
+
+    return IntRect(static_cast<int>(0.5f + width  * viewport.left),
+                   static_cast<int>(0.5f + height * viewport.top),
+                   static_cast<int>(0.5f + width  * viewport.width),
+                   static_cast<int>(0.5f + height * viewport.height));
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f RenderTarget::mapPixelToCoords(const iVector2i& point) const
+{
+    return mapPixelToCoords(point, getView());
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f RenderTarget::mapPixelToCoords(const iVector2i& point, const View& view) const
+{
+    // First, convert from viewport coordinates to homogeneous coordinates
+    iVector2f normalized;
+    FloatRect viewport = FloatRect(getViewport(view));
+    normalized.x = -1.f + 2.f * (static_cast<float>(point.x) - viewport.left) / viewport.width;
+    normalized.y =  1.f - 2.f * (static_cast<float>(point.y) - viewport.top)  / viewport.height;
+
+    // Then transform by the inverse of the view matrix
+    return view.getInverseTransform().transformPoint(normalized);
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2i RenderTarget::mapCoordsToPixel(const iVector2f& point) const
+{
+    return mapCoordsToPixel(point, getView());
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2i RenderTarget::mapCoordsToPixel(const iVector2f& point, const View& view) const
+{
+    // First, transform the point by the view matrix
+    iVector2f normalized = view.getTransform().transformPoint(point);
+
+    // Then convert to viewport coordinates
+    iVector2i pixel;
+    FloatRect viewport = FloatRect(getViewport(view));
+    pixel.x = static_cast<int>(( normalized.x + 1.f) / 2.f * viewport.width  + viewport.left);
+    pixel.y = static_cast<int>((-normalized.y + 1.f) / 2.f * viewport.height + viewport.top);
+
+    return pixel;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::cull(const FloatRect& bounds)
+{
+    // Inclusive comparisons, so that flat objects (lines) are not culled
+    bool visible = (bounds.left <= m_viewBounds.left + m_viewBounds.width) &&
+                   (bounds.left + bounds.width >= m_viewBounds.left) &&
+                   (bounds.top <= m_viewBounds.top + m_viewBounds.height) &&
+                   (bounds.top + bounds.height >= m_viewBounds.top);
+
+    if (visible)
+        return false;
+
+    ++m_stats.culledObjects;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::initialize()
+{
+    // Setup the default and current views
+    iVector2u size = getSize();
+    m_defaultView.reset(FloatRect(0, 0, static_cast<float>(size.x), static_cast<float>(size.y)));
+    setView(m_defaultView);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::display()
+{
+    SFML_PROFILE_SCOPE("RenderTarget::display");
+
+    onDisplay();
+
+    m_statsHistory[m_frameCount % m_statsHistory.size()] = m_stats;
+    ++m_frameCount;
+    m_stats.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderStats& RenderTarget::getStats() const
+{
+    return m_stats;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderStats& RenderTarget::getFrameStats(std::size_t framesAgo) const
+{
+    std::size_t index = (m_frameCount + m_statsHistory.size() - 1 - framesAgo) % m_statsHistory.size();
+    return m_statsHistory[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::getStatsHistorySize() const
+{
+    return std::min(m_frameCount, m_statsHistory.size());
+}
+
+
+////////////////////////////////////////////////////////////
+RenderStats& RenderTarget::getCurrentStats()
+{
+    return m_stats;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::onDisplay()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::onViewChanged()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                                 std::size_t instanceCount, const RenderStates& states)
+{
+    // Expand every instance into its own quad
+    m_instanceVertices.resize(instanceCount * 4);
+
+    for (std::size_t i = 0; i < instanceCount; ++i)
+    {
+        const SpriteInstance& instance = instances[i];
+        Vertex* vertices = &m_instanceVertices[i * 4];
+
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            vertices[j].position  = instance.transformPoint(quad[j].position);
+            vertices[j].color     = quad[j].color * instance.color;
+            vertices[j].texCoords = quad[j].texCoords;
+        }
+    }
+
+    drawPrimitives(&m_instanceVertices[0], m_instanceVertices.size(), Quads, states);
+}
+
+} // namespace sf
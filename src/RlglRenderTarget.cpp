@@ -0,0 +1,584 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "RlglRenderTarget.hpp"
+#include "SpriteInstance.hpp"
+#include "VertexBuffer.hpp"
+#include "RlglSubmit.hpp"
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+#include <algorithm>
+#include <cstddef>
+
+
+namespace
+{
+    // Number of vertices from which triangle arrays are drawn from a GPU buffer
+    const std::size_t streamThreshold = 4096;
+
+    // Factors converting pixel texture coordinates to normalized ones
+    sf::iVector2f getTexCoordScale(const Texture2D* texture)
+    {
+        if (!texture || (texture->width <= 0) || (texture->height <= 0))
+            return sf::iVector2f(1.f, 1.f);
+
+        return sf::iVector2f(1.f / texture->width, 1.f / texture->height);
+    }
+
+    // Texture to bind for the given render states; untextured
+    // geometry uses the default (white) texture
+    unsigned int getTextureId(const Texture2D* texture)
+    {
+        return (texture && (texture->id > 0)) ? texture->id : rlGetTextureIdDefault();
+    }
+
+    // Convert an sf::BlendMode::Factor constant to the corresponding rlgl constant.
+    int factorToRlglConstant(sf::BlendMode::Factor blendFactor)
+    {
+        switch (blendFactor)
+        {
+            case sf::BlendMode::Zero:             return RL_ZERO;
+            case sf::BlendMode::One:              return RL_ONE;
+            case sf::BlendMode::SrcColor:         return RL_SRC_COLOR;
+            case sf::BlendMode::OneMinusSrcColor: return RL_ONE_MINUS_SRC_COLOR;
+            case sf::BlendMode::DstColor:         return RL_DST_COLOR;
+            case sf::BlendMode::OneMinusDstColor: return RL_ONE_MINUS_DST_COLOR;
+            case sf::BlendMode::SrcAlpha:         return RL_SRC_ALPHA;
+            case sf::BlendMode::OneMinusSrcAlpha: return RL_ONE_MINUS_SRC_ALPHA;
+            case sf::BlendMode::DstAlpha:         return RL_DST_ALPHA;
+            case sf::BlendMode::OneMinusDstAlpha: return RL_ONE_MINUS_DST_ALPHA;
+        }
+
+        return RL_ZERO;
+    }
+
+    // Convert an sf::BlendMode::Equation constant to the corresponding rlgl constant.
+    int equationToRlglConstant(sf::BlendMode::Equation blendEquation)
+    {
+        switch (blendEquation)
+        {
+            case sf::BlendMode::Add:             return RL_FUNC_ADD;
+            case sf::BlendMode::Subtract:        return RL_FUNC_SUBTRACT;
+            case sf::BlendMode::ReverseSubtract: return RL_FUNC_REVERSE_SUBTRACT;
+        }
+
+        return RL_FUNC_ADD;
+    }
+
+    // Shaders of the instanced draws: every instance transforms the
+    // quad by its two matrix rows, and modulates it by its color
+    const char* instancingVertexShader =
+        "#version 330\n"
+        "in vec2 vertexPosition;\n"
+        "in vec2 vertexTexCoord;\n"
+        "in vec4 vertexColor;\n"
+        "in vec3 instanceRow0;\n"
+        "in vec3 instanceRow1;\n"
+        "in vec4 instanceColor;\n"
+        "uniform mat4 mvp;\n"
+        "out vec2 fragTexCoord;\n"
+        "out vec4 fragColor;\n"
+        "void main()\n"
+        "{\n"
+        "    vec3 local = vec3(vertexPosition, 1.0);\n"
+        "    vec2 position = vec2(dot(instanceRow0, local), dot(instanceRow1, local));\n"
+        "    fragTexCoord = vertexTexCoord;\n"
+        "    fragColor = vertexColor * instanceColor;\n"
+        "    gl_Position = mvp * vec4(position, 0.0, 1.0);\n"
+        "}\n";
+
+    const char* instancingFragmentShader =
+        "#version 330\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "uniform sampler2D texture0;\n"
+        "out vec4 finalColor;\n"
+        "void main()\n"
+        "{\n"
+        "    finalColor = texture(texture0, fragTexCoord) * fragColor;\n"
+        "}\n";
+
+    // Names of the attributes of the instancing shader, vertex ones first
+    const char* instancingAttributeNames[] =
+    {
+        "vertexPosition", "vertexTexCoord", "vertexColor",
+        "instanceRow0", "instanceRow1", "instanceColor"
+    };
+
+    // Number of instances the instance buffer holds when it is created
+    const std::size_t initialInstanceCapacity = 1024;
+
+    // Describe the layout of sf::Vertex to the instancing shader
+    void setQuadAttributes(const int* locations)
+    {
+        const int stride = static_cast<int>(sizeof(sf::Vertex));
+
+        rlSetVertexAttribute(locations[0], 2, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, position)));
+        rlEnableVertexAttribute(locations[0]);
+
+        rlSetVertexAttribute(locations[1], 2, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, texCoords)));
+        rlEnableVertexAttribute(locations[1]);
+
+        rlSetVertexAttribute(locations[2], 4, RL_UNSIGNED_BYTE, true, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, color)));
+        rlEnableVertexAttribute(locations[2]);
+    }
+
+    // Describe the layout of sf::SpriteInstance to the instancing shader;
+    // the attributes advance once per instance instead of once per vertex
+    void setInstanceAttributes(const int* locations)
+    {
+        const int stride = static_cast<int>(sizeof(sf::SpriteInstance));
+
+        rlSetVertexAttribute(locations[3], 3, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::SpriteInstance, matrix)));
+        rlSetVertexAttribute(locations[4], 3, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::SpriteInstance, matrix) + 3 * sizeof(float)));
+        rlSetVertexAttribute(locations[5], 4, RL_UNSIGNED_BYTE, true, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::SpriteInstance, color)));
+
+        for (int i = 3; i < 6; ++i)
+        {
+            rlSetVertexAttributeDivisor(locations[i], 1);
+            rlEnableVertexAttribute(locations[i]);
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RlglRenderTarget::RlglRenderTarget() :
+m_cache       (),
+m_instancing  (),
+m_streamBuffer(VertexBuffer::Stream)
+{
+    // Nothing to restore yet: the target hasn't drawn anything
+    m_cache.enable      = false;
+    m_cache.viewChanged = true;
+    m_cache.textureSet  = false;
+
+    // The instancing resources are only created by the first instanced draw
+    m_instancing.loaded      = false;
+    m_instancing.shader      = 0;
+    m_instancing.vao         = 0;
+    m_instancing.quadVbo     = 0;
+    m_instancing.instanceVbo = 0;
+    m_instancing.capacity    = 0;
+
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+RlglRenderTarget::~RlglRenderTarget()
+{
+    if (m_instancing.instanceVbo)
+        rlUnloadVertexBuffer(m_instancing.instanceVbo);
+
+    if (m_instancing.quadVbo)
+        rlUnloadVertexBuffer(m_instancing.quadVbo);
+
+    if (m_instancing.vao)
+        rlUnloadVertexArray(m_instancing.vao);
+
+    if (m_instancing.shader)
+        rlUnloadShaderProgram(m_instancing.shader);
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2u RlglRenderTarget::getSize() const
+{
+    return iVector2u(static_cast<unsigned int>(rlGetFramebufferWidth()), static_cast<unsigned int>(rlGetFramebufferHeight()));
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::onDisplay()
+{
+    resetGLStates();
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::onViewChanged()
+{
+    m_cache.viewChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::resetGLStates()
+{
+    // The states of raylib were only changed if the target drew something
+    if (m_cache.enable)
+    {
+        // Draw what was batched under the view of the target first
+        rlDrawRenderBatchActive();
+        ++getCurrentStats().batchFlushes;
+
+        // Leave raylib with its own states for whatever it draws next
+        if (m_cache.lastBlendMode != BlendAlpha)
+            rlSetBlendMode(RL_BLEND_ALPHA);
+
+        iVector2u size = getSize();
+        rlViewport(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+        rlSetMatrixProjection(m_cache.raylibProjection);
+        rlSetMatrixModelview(m_cache.raylibModelview);
+    }
+
+    m_cache.enable      = false;
+    m_cache.viewChanged = true;
+    m_cache.textureSet  = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                      PrimitiveType type, const RenderStates& states)
+{
+    // Large triangle arrays are copied to the GPU at once, rather than sent
+    // to the batch with a color, texture coordinates and position per vertex
+    bool triangles = (type != Points) && (type != Lines) && (type != LineStrip);
+    if ((vertexCount >= streamThreshold) && triangles && VertexBuffer::isAvailable())
+    {
+        m_streamBuffer.setPrimitiveType(type);
+        m_streamBuffer.m_vertices.resize(vertexCount);
+        m_streamBuffer.update(vertices, vertexCount, 0);
+
+        drawBuffer(m_streamBuffer, states);
+        return;
+    }
+
+    bool textured = states.texture && (states.texture->id > 0);
+    iVector2f texCoordScale = getTexCoordScale(states.texture);
+
+    // Pre-transform the vertices of small drawables (sprites, ...) on the CPU,
+    // rather than pushing a new matrix for a handful of vertices; points are
+    // excluded since they are expanded in local coordinates
+    bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize) && (type != Points);
+    if (useVertexCache)
+    {
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            Vertex& vertex = m_cache.vertexCache[i];
+            vertex.position = states.transform.transformPoint(vertices[i].position);
+            vertex.color = vertices[i].color;
+            vertex.texCoords = vertices[i].texCoords;
+        }
+
+        vertices = m_cache.vertexCache;
+    }
+
+    // The identity transform doesn't need to go through the matrix stack
+    bool useTransform = !useVertexCache && (states.transform != Transform::Identity);
+
+    if (!m_cache.enable || m_cache.viewChanged)
+        applyCurrentView();
+
+    if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+        applyBlendMode(states.blendMode);
+
+    applyTexture(getTextureId(states.texture), priv::getRlglPrimitive(type));
+
+    if (useTransform)
+    {
+        float matrix[16];
+        states.transform.getMatrix(matrix);
+        rlPushMatrix();
+        rlMultMatrixf(matrix);
+        ++getCurrentStats().matrixPushes;
+    }
+
+    getCurrentStats().batchFlushes += priv::submitVertices(vertices, vertexCount, type, textured ? &texCoordScale : NULL);
+
+    if (useTransform)
+        rlPopMatrix();
+
+    m_cache.enable = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    if (!m_cache.enable || m_cache.viewChanged)
+        applyCurrentView();
+
+    if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+        applyBlendMode(states.blendMode);
+
+    m_cache.enable = true;
+
+    if (vertexBuffer.render(states.transform, getTextureId(states.texture), getTexCoordScale(states.texture)))
+    {
+        // Rendering flushed the batch, which unbound the cached texture
+        m_cache.textureSet = false;
+
+        RenderStats& stats = getCurrentStats();
+        ++stats.batchFlushes;
+        ++stats.textureBinds;
+        ++stats.matrixPushes;
+    }
+    else
+    {
+        // The buffer can't be drawn from the GPU: stream its vertices instead
+        drawPrimitives(&vertexBuffer.m_vertices[0], vertexBuffer.m_vertices.size(), vertexBuffer.m_primitiveType, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::drawInstances(const Vertex* quad, const SpriteInstance* instances,
+                                     std::size_t instanceCount, const RenderStates& states)
+{
+    if (!loadInstancing())
+    {
+        RenderTarget::drawInstances(quad, instances, instanceCount, states);
+        return;
+    }
+
+    if (!m_cache.enable || m_cache.viewChanged)
+        applyCurrentView();
+
+    if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+        applyBlendMode(states.blendMode);
+
+    m_cache.enable = true;
+
+    // Flush what was batched so far, to preserve the drawing order;
+    // flushing also unbinds the cached texture
+    rlDrawRenderBatchActive();
+    m_cache.textureSet = false;
+
+    // Send the quad as two triangles, with normalized texture coordinates
+    static const std::size_t corners[6] = {0, 1, 2, 0, 2, 3};
+    iVector2f texCoordScale = getTexCoordScale(states.texture);
+
+    Vertex triangles[6];
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        triangles[i] = quad[corners[i]];
+        triangles[i].texCoords.x *= texCoordScale.x;
+        triangles[i].texCoords.y *= texCoordScale.y;
+    }
+
+    rlUpdateVertexBuffer(m_instancing.quadVbo, triangles, static_cast<int>(sizeof(triangles)), 0);
+
+    // Send the instances, growing their buffer if it is too small
+    int instanceSize = static_cast<int>(instanceCount * sizeof(SpriteInstance));
+    if (instanceCount > m_instancing.capacity)
+    {
+        m_instancing.capacity = std::max(instanceCount, m_instancing.capacity * 2);
+        rlUnloadVertexBuffer(m_instancing.instanceVbo);
+
+        rlEnableVertexArray(m_instancing.vao);
+        m_instancing.instanceVbo = rlLoadVertexBuffer(NULL, static_cast<int>(m_instancing.capacity * sizeof(SpriteInstance)), true);
+        setInstanceAttributes(m_instancing.attributes);
+        rlDisableVertexArray();
+    }
+
+    rlUpdateVertexBuffer(m_instancing.instanceVbo, instances, instanceSize, 0);
+
+    // Draw every instance with a single call
+    rlDisableBackfaceCulling();
+
+    float matrix[16];
+    states.transform.getMatrix(matrix);
+    rlPushMatrix();
+    rlMultMatrixf(matrix);
+
+    rlEnableShader(m_instancing.shader);
+
+    Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    rlSetUniformMatrix(m_instancing.mvpLocation, MatrixMultiply(modelView, rlGetMatrixProjection()));
+
+    const int slot = 0;
+    rlSetUniform(m_instancing.textureLocation, &slot, RL_SHADER_UNIFORM_SAMPLER2D, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(getTextureId(states.texture));
+
+    rlEnableVertexArray(m_instancing.vao);
+    rlDrawVertexArrayInstanced(0, 6, static_cast<int>(instanceCount));
+
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+
+    rlPopMatrix();
+
+    RenderStats& stats = getCurrentStats();
+    ++stats.batchFlushes;
+    ++stats.textureBinds;
+    ++stats.matrixPushes;
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::applyCurrentView()
+{
+    // Whatever is batched was meant for the previous projection;
+    // flushing also unbinds the cached texture
+    rlDrawRenderBatchActive();
+    m_cache.textureSet = false;
+
+    // Keep raylib's matrices, to give them back in resetGLStates
+    if (!m_cache.enable)
+    {
+        m_cache.raylibProjection = rlGetMatrixProjection();
+        m_cache.raylibModelview  = rlGetMatrixModelview();
+    }
+
+    // Set the viewport; rlgl counts the rows from the bottom of the target
+    IntRect viewport = getViewport(getView());
+    int top = static_cast<int>(getSize().y) - (viewport.top + viewport.height);
+    rlViewport(viewport.left, top, viewport.width, viewport.height);
+
+    // Set the projection matrix; the transforms of the drawables go
+    // through the modelview matrix, which starts from the identity
+    rlMatrixMode(RL_PROJECTION);
+    float matrix[16];
+    getView().getTransform().getMatrix(matrix);
+    rlLoadIdentity();
+    rlMultMatrixf(matrix);
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+
+    m_cache.viewChanged = false;
+
+    RenderStats& stats = getCurrentStats();
+    ++stats.viewChanges;
+    ++stats.batchFlushes;
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::applyBlendMode(const BlendMode& mode)
+{
+    if (mode == BlendAlpha)
+    {
+        rlSetBlendMode(RL_BLEND_ALPHA);
+    }
+    else
+    {
+        // rlgl only re-applies custom factors when entering the custom
+        // mode, so leave it first when switching between two custom modes.
+        // rlgl has a single set of custom factors: the color ones are
+        // used for the alpha channel as well
+        if (m_cache.enable && (m_cache.lastBlendMode != BlendAlpha))
+            rlSetBlendMode(RL_BLEND_ALPHA);
+
+        rlSetBlendFactors(factorToRlglConstant(mode.colorSrcFactor),
+                          factorToRlglConstant(mode.colorDstFactor),
+                          equationToRlglConstant(mode.colorEquation));
+        rlSetBlendMode(RL_BLEND_CUSTOM);
+    }
+
+    m_cache.lastBlendMode = mode;
+
+    // rlgl flushes its batch before changing the blending; the first
+    // mode applied in a frame is usually raylib's current one already
+    if (m_cache.enable)
+    {
+        RenderStats& stats = getCurrentStats();
+        ++stats.blendModeChanges;
+        ++stats.batchFlushes;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RlglRenderTarget::applyTexture(unsigned int textureId, int primitive)
+{
+    // rlgl starts its new draw calls with the default texture when
+    // the primitive changes, so the texture is only known to be bound
+    // if the primitive is the same as well
+    if (m_cache.textureSet && (textureId == m_cache.lastTextureId) && (primitive == m_cache.lastPrimitive))
+        return;
+
+    rlSetTexture(textureId);
+    ++getCurrentStats().textureBinds;
+
+    m_cache.textureSet    = true;
+    m_cache.lastTextureId = textureId;
+    m_cache.lastPrimitive = primitive;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RlglRenderTarget::loadInstancing()
+{
+    if (m_instancing.loaded)
+        return m_instancing.shader != 0;
+
+    m_instancing.loaded = true;
+
+    // Instanced arrays and the shaders above need OpenGL 3.3
+    int version = rlGetVersion();
+    if ((version != RL_OPENGL_33) && (version != RL_OPENGL_43))
+        return false;
+
+    unsigned int shader = rlLoadShaderCode(instancingVertexShader, instancingFragmentShader);
+    if (shader == 0)
+        return false;
+
+    for (int i = 0; i < Instancing::AttributeCount; ++i)
+    {
+        m_instancing.attributes[i] = rlGetLocationAttrib(shader, instancingAttributeNames[i]);
+        if (m_instancing.attributes[i] < 0)
+        {
+            rlUnloadShaderProgram(shader);
+            return false;
+        }
+    }
+
+    m_instancing.shader          = shader;
+    m_instancing.mvpLocation     = rlGetLocationUniform(shader, "mvp");
+    m_instancing.textureLocation = rlGetLocationUniform(shader, "texture0");
+
+    // Bind the quad and the instances to a vertex array object once and for all
+    m_instancing.vao = rlLoadVertexArray();
+    rlEnableVertexArray(m_instancing.vao);
+
+    m_instancing.quadVbo = rlLoadVertexBuffer(NULL, static_cast<int>(6 * sizeof(Vertex)), true);
+    setQuadAttributes(m_instancing.attributes);
+
+    m_instancing.capacity    = initialInstanceCapacity;
+    m_instancing.instanceVbo = rlLoadVertexBuffer(NULL, static_cast<int>(m_instancing.capacity * sizeof(SpriteInstance)), true);
+    setInstanceAttributes(m_instancing.attributes);
+
+    rlDisableVertexArray();
+
+    return true;
+}
+
+} // namespace sf
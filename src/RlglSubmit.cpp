@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "RlglSubmit.hpp"
+#include <raylib.h>
+#include <rlgl.h>
+#include <algorithm>
+
+
+namespace
+{
+    // Number of vertices appended between two checks of the batch capacity;
+    // it must stay well below the size of the default rlgl batch
+    const std::size_t chunkSize = 4092;
+
+    // Writes vertices to rlgl; the color and texture coordinates are sent
+    // with every vertex, since rlgl versions before 4.2 don't keep them
+    // from one vertex to the next
+    class Emitter
+    {
+    public:
+
+        explicit Emitter(const sf::iVector2f* texCoordScale) :
+        m_textured(texCoordScale != NULL),
+        m_scale   (texCoordScale ? *texCoordScale : sf::iVector2f(1.f, 1.f))
+        {
+        }
+
+        void emit(const sf::Vertex& vertex)
+        {
+            emit(vertex, vertex.position.x, vertex.position.y);
+        }
+
+        void emit(const sf::Vertex& vertex, float x, float y)
+        {
+            rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+
+            if (m_textured)
+                rlTexCoord2f(vertex.texCoords.x * m_scale.x, vertex.texCoords.y * m_scale.y);
+
+            rlVertex2f(x, y);
+        }
+
+    private:
+
+        bool          m_textured;
+        sf::iVector2f m_scale;
+    };
+
+    // Emit primitiveCount primitives of verticesPerPrimitive output vertices each,
+    // checking the batch capacity once per chunk of whole primitives
+    // and returning the number of times the batch was flushed
+    template <typename EmitPrimitive>
+    std::size_t emitChunked(std::size_t primitiveCount, std::size_t verticesPerPrimitive, EmitPrimitive emitPrimitive)
+    {
+        const std::size_t primitivesPerChunk = chunkSize / verticesPerPrimitive;
+        std::size_t flushes = 0;
+
+        for (std::size_t first = 0; first < primitiveCount; first += primitivesPerChunk)
+        {
+            std::size_t last = std::min(first + primitivesPerChunk, primitiveCount);
+            if (rlCheckRenderBatchLimit(static_cast<int>((last - first) * verticesPerPrimitive)))
+                ++flushes;
+
+            for (std::size_t i = first; i < last; ++i)
+                emitPrimitive(i);
+        }
+
+        return flushes;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+std::size_t submitVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const iVector2f* texCoordScale)
+{
+    if (!vertices || (vertexCount == 0))
+        return 0;
+
+    // 2D geometry has no meaningful facing, and shapes may be
+    // defined in any winding order
+    rlDisableBackfaceCulling();
+
+    Emitter emitter(texCoordScale);
+    std::size_t flushes = 0;
+
+    switch (type)
+    {
+        case Points:
+        {
+            // rlgl has no point primitive: emit a one-unit quad per point
+            rlBegin(RL_QUADS);
+            flushes = emitChunked(vertexCount, 4, [&](std::size_t i)
+            {
+                const Vertex& v = vertices[i];
+                emitter.emit(v, v.position.x,       v.position.y);
+                emitter.emit(v, v.position.x,       v.position.y + 1.f);
+                emitter.emit(v, v.position.x + 1.f, v.position.y + 1.f);
+                emitter.emit(v, v.position.x + 1.f, v.position.y);
+            });
+            rlEnd();
+            break;
+        }
+
+        case Lines:
+        {
+            rlBegin(RL_LINES);
+            flushes = emitChunked(vertexCount / 2, 2, [&](std::size_t i)
+            {
+                emitter.emit(vertices[i * 2 + 0]);
+                emitter.emit(vertices[i * 2 + 1]);
+            });
+            rlEnd();
+            break;
+        }
+
+        case LineStrip:
+        {
+            if (vertexCount < 2)
+                break;
+
+            rlBegin(RL_LINES);
+            flushes = emitChunked(vertexCount - 1, 2, [&](std::size_t i)
+            {
+                emitter.emit(vertices[i]);
+                emitter.emit(vertices[i + 1]);
+            });
+            rlEnd();
+            break;
+        }
+
+        case Triangles:
+        {
+            rlBegin(RL_TRIANGLES);
+            flushes = emitChunked(vertexCount / 3, 3, [&](std::size_t i)
+            {
+                emitter.emit(vertices[i * 3 + 0]);
+                emitter.emit(vertices[i * 3 + 1]);
+                emitter.emit(vertices[i * 3 + 2]);
+            });
+            rlEnd();
+            break;
+        }
+
+        case TriangleStrip:
+        {
+            if (vertexCount < 3)
+                break;
+
+            // Swap the first two vertices of every odd triangle to keep a consistent winding
+            rlBegin(RL_TRIANGLES);
+            flushes = emitChunked(vertexCount - 2, 3, [&](std::size_t i)
+            {
+                emitter.emit(vertices[(i % 2 == 0) ? i : i + 1]);
+                emitter.emit(vertices[(i % 2 == 0) ? i + 1 : i]);
+                emitter.emit(vertices[i + 2]);
+            });
+            rlEnd();
+            break;
+        }
+
+        case TriangleFan:
+        {
+            if (vertexCount < 3)
+                break;
+
+            rlBegin(RL_TRIANGLES);
+            flushes = emitChunked(vertexCount - 2, 3, [&](std::size_t i)
+            {
+                emitter.emit(vertices[0]);
+                emitter.emit(vertices[i + 1]);
+                emitter.emit(vertices[i + 2]);
+            });
+            rlEnd();
+            break;
+        }
+
+        case Quads:
+        {
+            rlBegin(RL_QUADS);
+            flushes = emitChunked(vertexCount / 4, 4, [&](std::size_t i)
+            {
+                emitter.emit(vertices[i * 4 + 0]);
+                emitter.emit(vertices[i * 4 + 1]);
+                emitter.emit(vertices[i * 4 + 2]);
+                emitter.emit(vertices[i * 4 + 3]);
+            });
+            rlEnd();
+            break;
+        }
+    }
+
+    return flushes;
+}
+
+
+////////////////////////////////////////////////////////////
+int getRlglPrimitive(PrimitiveType type)
+{
+    switch (type)
+    {
+        case Lines:
+        case LineStrip:
+            return RL_LINES;
+
+        case Points:
+        case Quads:
+            return RL_QUADS;
+
+        default:
+            return RL_TRIANGLES;
+    }
+}
+
+} // namespace priv
+
+} // namespace sf
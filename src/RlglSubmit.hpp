@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RLGLSUBMIT_HPP
+#define SFML_RLGLSUBMIT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Vertex.hpp"
+#include "PrimitiveType.hpp"
+#include "Vector2.hpp"
+#include <cstddef>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Append vertices to the active rlgl batch
+///
+/// Every primitive type is converted to the closest rlgl
+/// primitive (RL_LINES, RL_TRIANGLES or RL_QUADS). The batch
+/// capacity is checked once per chunk of whole primitives
+/// rather than once per primitive. The color and texture
+/// coordinates are sent with every vertex, since rlgl versions
+/// before 4.2 don't keep them from one vertex to the next; large
+/// arrays of triangles don't come here, RlglRenderTarget draws
+/// them from a stream vertex buffer.
+///
+/// The texture must be bound by the caller. Texture coordinates
+/// are multiplied by \a texCoordScale, so that they can be given
+/// in pixels.
+///
+/// \param vertices      Pointer to the vertices
+/// \param vertexCount   Number of vertices
+/// \param type          Type of primitives to draw
+/// \param texCoordScale Scale of the texture coordinates, or NULL
+///                      if texture coordinates must not be sent
+///
+/// \return Number of times the batch was flushed to make room
+///
+////////////////////////////////////////////////////////////
+std::size_t submitVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const iVector2f* texCoordScale);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the rlgl primitive that submitVertices uses
+///        for a primitive type
+///
+/// \param type Type of primitives
+///
+/// \return RL_LINES, RL_TRIANGLES or RL_QUADS
+///
+////////////////////////////////////////////////////////////
+int getRlglPrimitive(PrimitiveType type);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_RLGLSUBMIT_HPP
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SceneNode.hpp"
+#include "RenderTarget.hpp"
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SceneNode::SceneNode() :
+m_parent         (NULL),
+m_children       (),
+m_worldTransform (),
+m_worldNeedUpdate(true),
+m_localRevision  (0),
+m_parentRevision (0),
+m_worldRevision  (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SceneNode::~SceneNode()
+{
+    if (m_parent)
+        m_parent->detachChild(*this);
+
+    for (std::size_t i = 0; i < m_children.size(); ++i)
+    {
+        m_children[i]->m_parent = NULL;
+        m_children[i]->m_worldNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::attachChild(SceneNode& child)
+{
+    if (child.m_parent)
+        child.m_parent->detachChild(child);
+
+    m_children.push_back(&child);
+    child.m_parent = this;
+    child.m_worldNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::detachChild(SceneNode& child)
+{
+    std::vector<SceneNode*>::iterator it = std::find(m_children.begin(), m_children.end(), &child);
+    if (it == m_children.end())
+        return;
+
+    m_children.erase(it);
+    child.m_parent = NULL;
+    child.m_worldNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+SceneNode* SceneNode::getParent() const
+{
+    return m_parent;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SceneNode::getChildCount() const
+{
+    return m_children.size();
+}
+
+
+////////////////////////////////////////////////////////////
+SceneNode& SceneNode::getChild(std::size_t index) const
+{
+    return *m_children[index];
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& SceneNode::getWorldTransform() const
+{
+    // Bring the ancestors up to date first, from the root down
+    if (m_parent)
+        m_parent->getWorldTransform();
+
+    updateWorldTransform();
+
+    return m_worldTransform;
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::drawCurrent(RenderTarget&, RenderStates) const
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_parent)
+        m_parent->getWorldTransform();
+
+    drawTree(target, states, states.transform == Transform::Identity);
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::drawTree(RenderTarget& target, const RenderStates& states, bool identity) const
+{
+    updateWorldTransform();
+
+    RenderStates nodeStates(states);
+    if (identity)
+        nodeStates.transform = m_worldTransform;
+    else
+        nodeStates.transform *= m_worldTransform;
+
+    drawCurrent(target, nodeStates);
+
+    for (std::size_t i = 0; i < m_children.size(); ++i)
+        m_children[i]->drawTree(target, states, identity);
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneNode::updateWorldTransform() const
+{
+    Uint32 localRevision  = getTransformRevision();
+    Uint32 parentRevision = m_parent ? m_parent->m_worldRevision : 0;
+
+    if (!m_worldNeedUpdate && (localRevision == m_localRevision) && (parentRevision == m_parentRevision))
+        return;
+
+    if (m_parent)
+        m_worldTransform = Transform(m_parent->m_worldTransform).combine(getTransform());
+    else
+        m_worldTransform = getTransform();
+
+    m_localRevision   = localRevision;
+    m_parentRevision  = parentRevision;
+    m_worldNeedUpdate = false;
+    ++m_worldRevision;
+}
+
+} // namespace sf
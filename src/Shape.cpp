@@ -26,8 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Shape.hpp"
-#include <raylib.h>
-#include <rlgl.h>
+#include "RenderTarget.hpp"
+#include "Profiler.hpp"
 #include <stdlib.h>
 #include <cstdio>
 #include <cmath>
@@ -50,6 +50,35 @@ namespace
     {
         return p1.x * p2.x + p1.y * p2.y;
     }
+
+    // Expand a triangle fan into independent triangles
+    void fanToTriangles(const sf::VertexArray& fan, sf::VertexArray& triangles)
+    {
+        std::size_t count = (fan.getVertexCount() < 3) ? 0 : fan.getVertexCount() - 2;
+        triangles.resize(count * 3);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            triangles[i * 3 + 0] = fan[0];
+            triangles[i * 3 + 1] = fan[i + 1];
+            triangles[i * 3 + 2] = fan[i + 2];
+        }
+    }
+
+    // Expand a triangle strip into independent triangles, swapping the
+    // first two vertices of every odd triangle to keep a consistent winding
+    void stripToTriangles(const sf::VertexArray& strip, sf::VertexArray& triangles)
+    {
+        std::size_t count = (strip.getVertexCount() < 3) ? 0 : strip.getVertexCount() - 2;
+        triangles.resize(count * 3);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            triangles[i * 3 + 0] = strip[(i % 2 == 0) ? i : i + 1];
+            triangles[i * 3 + 1] = strip[(i % 2 == 0) ? i + 1 : i];
+            triangles[i * 3 + 2] = strip[i + 2];
+        }
+    }
 }
 
 
@@ -88,7 +117,8 @@ void Shape::setTexture( Texture2D texture, bool resetRect)
 void Shape::setTextureRect(const IntRect& rect)
 {
     m_textureRect = rect;
-    updateTexCoords();
+    m_texCoordsNeedUpdate = true;
+    m_verticesState.invalidate();
     m_useTexture=true;
 }
 
@@ -104,7 +134,8 @@ const IntRect& Shape::getTextureRect() const
 void Shape::setFillColor(const iColor& color)
 {
     m_fillColor = color;
-    updateFillColors();
+    m_fillColorsNeedUpdate = true;
+    m_verticesState.invalidate();
 }
 
 
@@ -119,7 +150,8 @@ const iColor& Shape::getFillColor() const
 void Shape::setOutlineColor(const iColor& color)
 {
     m_outlineColor = color;
-    updateOutlineColors();
+    m_outlineColorsNeedUpdate = true;
+    m_verticesState.invalidate();
 }
 
 
@@ -134,7 +166,8 @@ const iColor& Shape::getOutlineColor() const
 void Shape::setOutlineThickness(float thickness)
 {
     m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    m_outlineNeedUpdate = true; // the fill is not affected, only the outline and the bounds
+    m_verticesState.invalidate();
 }
 
 
@@ -148,6 +181,8 @@ float Shape::getOutlineThickness() const
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
+    updateIfNeeded();
+
     return m_bounds;
 }
 
@@ -168,10 +203,18 @@ m_outlineThickness(0),
 m_vertices        (TriangleFan),
 m_outlineVertices (TriangleStrip),
 m_insideBounds    (),
-m_bounds          ()
+m_bounds          (),
+m_fillTriangles   (Triangles),
+m_outlineTriangles(Triangles),
+m_geometryNeedUpdate     (true),
+m_fillColorsNeedUpdate   (false),
+m_texCoordsNeedUpdate    (false),
+m_outlineNeedUpdate      (false),
+m_outlineColorsNeedUpdate(false),
+m_verticesState          ()
 {
 m_texture = {0};
-m_texture.id=-1;
+m_texture.id=0;
 m_useTexture=false;
 }
 
@@ -179,12 +222,48 @@ m_useTexture=false;
 ////////////////////////////////////////////////////////////
 void Shape::update()
 {
+    m_geometryNeedUpdate = true;
+    m_verticesState.invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::draw(RenderTarget& target, RenderStates states) const
+{
+    updateIfNeeded();
+
+    states.transform *= getTransform();
+
+    // The bounds cover the outline as well
+    if (target.cull(states.transform.transformRect(getLocalBounds())))
+        return;
+
+    // Render the inside; the cached triangles are submitted directly,
+    // since the vertex array would test its own bounds again
+    states.texture = m_useTexture ? &m_texture : NULL;
+    if (m_fillTriangles.getVertexCount() > 0)
+        target.draw(&m_fillTriangles[0], m_fillTriangles.getVertexCount(), Triangles, states);
+
+    // Render the outline
+    if ((m_outlineThickness != 0) && (m_outlineTriangles.getVertexCount() > 0))
+    {
+        states.texture = NULL;
+        target.draw(&m_outlineTriangles[0], m_outlineTriangles.getVertexCount(), Triangles, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateGeometry() const
+{
+    SFML_PROFILE_SCOPE("Shape::updateGeometry");
+
     // Get the total number of points of the shape
     std::size_t count = getPointCount();
     if (count < 3)
     {
         m_vertices.resize(0);
-        m_outlineVertices.resize(0);
+        m_insideBounds = FloatRect();
         return;
     }
 
@@ -202,144 +281,68 @@ void Shape::update()
     // Compute the center and make it the first vertex
     m_vertices[0].position.x = m_insideBounds.left + m_insideBounds.width / 2;
     m_vertices[0].position.y = m_insideBounds.top + m_insideBounds.height / 2;
-
-    // Color
-    updateFillColors();
-
-    // Texture coordinates
-    updateTexCoords();
-
-    // Outline
-    updateOutline();
 }
 
 
 ////////////////////////////////////////////////////////////
-
-
-void Shape::draw() const
+void Shape::updateIfNeeded() const
 {
+    // Concurrent callers wait for the first one to rebuild the vertices
+    if (m_verticesState.isValid() || !m_verticesState.beginUpdate())
+        return;
 
-      static const char* modes[] = {"POINTS", "LINES", "LINE_STRIP", "TRIANGLES",
-                                   "TRIANGLE_STRIP", "TRIANGLE_FAN", "QUADS"};
-
-        rlPushMatrix();
-        rlMultMatrixf((float*)getTransform().getMatrix());
-
+    bool fillChanged    = m_geometryNeedUpdate || m_fillColorsNeedUpdate || m_texCoordsNeedUpdate;
+    bool outlineChanged = m_geometryNeedUpdate || m_outlineNeedUpdate || m_outlineColorsNeedUpdate;
 
-    if (m_vertices.getVertexCount() >= 1)
+    // New points invalidate everything derived from them
+    if (m_geometryNeedUpdate)
     {
-     int pointCount = (int) m_vertices.getVertexCount();
-
-        rlCheckRenderBatchLimit((pointCount - 2)*4);
-
-       if (m_useTexture)
-            rlSetTexture(m_texture.id);
-
-            rlBegin(RL_QUADS);
-
-
-
-
-            for (int i = 1; i < pointCount - 1; i++)
-            {
-
-
-                 iColor c2 =m_vertices[0].color;
-                 iColor c1 =m_vertices[i].color;
-                 iColor c0 =m_vertices[i+1].color;
-
-
-
-                Vector2 v2=(Vector2){m_vertices[0].position.x,m_vertices[0].position.y};
-                Vector2 v1=(Vector2){m_vertices[i].position.x,m_vertices[i].position.y};
-                Vector2 v0=(Vector2){m_vertices[i+1].position.x,m_vertices[i+1].position.y};
-
-                Vector2 vt2=(Vector2){m_vertices[0].texCoords.x,m_vertices[0].texCoords.y};
-                Vector2 vt1=(Vector2){m_vertices[i].texCoords.x,m_vertices[i].texCoords.y};
-                Vector2 vt0=(Vector2){m_vertices[i+1].texCoords.x,m_vertices[i+1].texCoords.y};
-
-                rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                rlTexCoord2f(vt0.x,vt0.y);
-                rlVertex2f(v0.x, v0.y);
-
-                rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                rlTexCoord2f(vt1.x,vt1.y);
-                rlVertex2f(v1.x, v1.y);
-
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlTexCoord2f(vt2.x,vt2.y);
-                rlVertex2f(v2.x, v2.y);
-
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlTexCoord2f(vt2.x,vt2.y);
-                rlVertex2f(v2.x, v2.y);
-            }
-        rlEnd();
-
+        updateGeometry();
+        m_geometryNeedUpdate   = false;
+        m_fillColorsNeedUpdate = true;
+        m_texCoordsNeedUpdate  = true;
+        m_outlineNeedUpdate    = true;
     }
 
-
-
-
-  if (m_outlineThickness != 0)
+    if (m_fillColorsNeedUpdate)
     {
+        updateFillColors();
+        m_fillColorsNeedUpdate = false;
+    }
 
-
-    rlSetTexture(0);
-
-    if (m_outlineVertices.getVertexCount() >= 1)
+    if (m_texCoordsNeedUpdate)
     {
-          int pointCount = (int) m_outlineVertices.getVertexCount();
-         rlCheckRenderBatchLimit(3*(pointCount - 2));
-
-
-
-          rlBegin(RL_TRIANGLES);
-            for (int i = 2; i < pointCount; i++)
-            {
-                if ((i%2) == 0)
-                {
-                    iColor c2 =m_outlineVertices[i-1].color;
-                    iColor c1 =m_outlineVertices[i-2].color;
-                    iColor c0 =m_outlineVertices[i].color;
-
-                    rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                    rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                    rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-
-                    rlVertex2f(m_outlineVertices[i - 1].position.x, m_outlineVertices[i - 1].position.y);
-                    rlVertex2f(m_outlineVertices[i - 2].position.x, m_outlineVertices[i - 2].position.y);
-                    rlVertex2f(m_outlineVertices[i].position.x, m_outlineVertices[i].position.y);
-                }
-                else
-                {
-
-                    iColor c2 =m_outlineVertices[i-2].color;
-                    iColor c1 =m_outlineVertices[i-1].color;
-                    iColor c0 =m_outlineVertices[i].color;
+        updateTexCoords();
+        m_texCoordsNeedUpdate = false;
+    }
 
-                    rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                    rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                    rlColor4ub(c2.r,c2.g,c2.b,c2.a);
+    // The outline colors are set along with the outline
+    if (m_outlineNeedUpdate)
+    {
+        updateOutline();
+        m_outlineNeedUpdate       = false;
+        m_outlineColorsNeedUpdate = false;
+    }
 
-                    rlVertex2f(m_outlineVertices[i - 2].position.x, m_outlineVertices[i - 2].position.y);
-                    rlVertex2f(m_outlineVertices[i - 1].position.x, m_outlineVertices[i - 1].position.y);
-                    rlVertex2f(m_outlineVertices[i].position.x, m_outlineVertices[i].position.y);
-                }
-            }
+    if (m_outlineColorsNeedUpdate)
+    {
+        updateOutlineColors();
+        m_outlineColorsNeedUpdate = false;
+    }
 
-         rlEnd();
+    // Refresh the triangle lists that are drawn
+    if (fillChanged)
+        fanToTriangles(m_vertices, m_fillTriangles);
 
-     }
-    }
+    if (outlineChanged)
+        stripToTriangles(m_outlineVertices, m_outlineTriangles);
 
-   rlPopMatrix();
+    m_verticesState.endUpdate();
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateFillColors()
+void Shape::updateFillColors() const
 {
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
         m_vertices[i].color = m_fillColor;
@@ -347,27 +350,23 @@ void Shape::updateFillColors()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateTexCoords()
+void Shape::updateTexCoords() const
 {
-     float width  = (float)m_textureRect.width;
-     float height = (float)m_textureRect.height;
-
-
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
     {
         float xratio = m_insideBounds.width  > 0 ? (m_vertices[i].position.x - m_insideBounds.left) / m_insideBounds.width : 0;
         float yratio = m_insideBounds.height > 0 ? (m_vertices[i].position.y - m_insideBounds.top) / m_insideBounds.height : 0;
-        m_vertices[i].texCoords.x = (m_textureRect.left + m_textureRect.width) * xratio;
-        m_vertices[i].texCoords.y = (m_textureRect.top + m_textureRect.height) * yratio;
+        m_vertices[i].texCoords.x = m_textureRect.left + m_textureRect.width * xratio;
+        m_vertices[i].texCoords.y = m_textureRect.top + m_textureRect.height * yratio;
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutline() const
 {
      // Return if there is no outline
-    if (m_outlineThickness == 0.f)
+    if ((m_outlineThickness == 0.f) || (m_vertices.getVertexCount() == 0))
     {
         m_outlineVertices.clear();
         m_bounds = m_insideBounds;
@@ -419,7 +418,7 @@ void Shape::updateOutline()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
     for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
         m_outlineVertices[i].color = m_outlineColor;
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SinCos.hpp"
+#include <cmath>
+
+#if defined(SFML_FAST_SINCOS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>
+    #define SFML_SINCOS_SSE2
+#endif
+
+
+#ifdef SFML_FAST_SINCOS
+
+namespace
+{
+    // Number of table entries per full turn
+    const int tableSize = 256;
+
+    // Angle between two table entries, in degrees; 360/256 = 45/32 is
+    // exactly representable, so multiples of it are exact as well
+    const float tableStep = 360.f / tableSize;
+
+    // Beyond this many steps, the multiples of the step are no longer exact
+    const float maxSteps = 262144.f;
+
+    // Conversion factors
+    const float stepsPerDegree   = tableSize / 360.f;
+    const float radiansPerDegree = 3.141592654f / 180.f;
+
+    ////////////////////////////////////////////////////////////
+    // Sines of the multiples of the step; the cosine of entry i
+    // is the sine of entry i + tableSize / 4
+    ////////////////////////////////////////////////////////////
+    const float* getSineTable()
+    {
+        struct Table
+        {
+            Table()
+            {
+                for (int i = 0; i < tableSize + tableSize / 4; ++i)
+                    values[i] = static_cast<float>(std::sin(i * 6.283185307179586 / tableSize));
+            }
+
+            float values[tableSize + tableSize / 4];
+        };
+
+        static const Table table;
+        return table.values;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Fast path, for angles of less than maxSteps steps; the
+    // SSE2 version below performs the same operations
+    ////////////////////////////////////////////////////////////
+    inline void sinCosReduced(const float* table, float degrees, float& sine, float& cosine)
+    {
+        // Exact reduction to the nearest table entry
+        int   step      = static_cast<int>(std::lrint(degrees * stepsPerDegree));
+        float remainder = degrees - static_cast<float>(step) * tableStep;
+
+        // Polynomials of the remainder, |r| < 0.0123 radians
+        float r  = remainder * radiansPerDegree;
+        float r2 = r * r;
+        float s  = r - r * r2 * (1.f / 6.f);
+        float c  = 1.f - r2 * 0.5f + r2 * r2 * (1.f / 24.f);
+
+        // Angle addition formulas
+        int   index      = step & (tableSize - 1);
+        float tableSine  = table[index];
+        float tableCos   = table[index + tableSize / 4];
+        sine   = tableSine * c + tableCos * s;
+        cosine = tableCos * c - tableSine * s;
+    }
+}
+
+#endif
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void sinCosDegrees(float degrees, float& sine, float& cosine)
+{
+#ifdef SFML_FAST_SINCOS
+
+    if (!(std::fabs(degrees * stepsPerDegree) < maxSteps))
+        degrees = static_cast<float>(std::fmod(degrees, 360.f));
+
+    sinCosReduced(getSineTable(), degrees, sine, cosine);
+
+#else
+
+    float angle = degrees * 3.141592654f / 180.f;
+    sine   = static_cast<float>(std::sin(angle));
+    cosine = static_cast<float>(std::cos(angle));
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void sinCosDegrees(const float* degrees, float* sines, float* cosines, std::size_t count)
+{
+    std::size_t i = 0;
+
+#ifdef SFML_SINCOS_SSE2
+
+    const float* table = getSineTable();
+
+    const __m128 limit    = _mm_set1_ps(maxSteps);
+    const __m128 absMask  = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 toSteps  = _mm_set1_ps(stepsPerDegree);
+    const __m128 step     = _mm_set1_ps(tableStep);
+    const __m128 toRadian = _mm_set1_ps(radiansPerDegree);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 angle = _mm_loadu_ps(degrees + i);
+        __m128 steps = _mm_mul_ps(angle, toSteps);
+
+        // Leave groups with a huge angle to the scalar path
+        if (_mm_movemask_ps(_mm_cmplt_ps(_mm_and_ps(steps, absMask), limit)) != 0xF)
+        {
+            for (std::size_t k = i; k < i + 4; ++k)
+                sinCosDegrees(degrees[k], sines[k], cosines[k]);
+            continue;
+        }
+
+        // Exact reduction to the nearest table entries
+        __m128i nearest   = _mm_cvtps_epi32(steps);
+        __m128  remainder = _mm_sub_ps(angle, _mm_mul_ps(_mm_cvtepi32_ps(nearest), step));
+
+        // Polynomials of the remainders
+        __m128 r  = _mm_mul_ps(remainder, toRadian);
+        __m128 r2 = _mm_mul_ps(r, r);
+        __m128 s  = _mm_sub_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), _mm_set1_ps(1.f / 6.f)));
+        __m128 c  = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(r2, _mm_set1_ps(0.5f))),
+                               _mm_mul_ps(_mm_mul_ps(r2, r2), _mm_set1_ps(1.f / 24.f)));
+
+        // Table lookups, one lane at a time (SSE2 has no gather)
+        int indices[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), _mm_and_si128(nearest, _mm_set1_epi32(tableSize - 1)));
+        __m128 tableSine = _mm_setr_ps(table[indices[0]], table[indices[1]], table[indices[2]], table[indices[3]]);
+        __m128 tableCos  = _mm_setr_ps(table[indices[0] + tableSize / 4], table[indices[1] + tableSize / 4],
+                                       table[indices[2] + tableSize / 4], table[indices[3] + tableSize / 4]);
+
+        // Angle addition formulas
+        _mm_storeu_ps(sines + i,   _mm_add_ps(_mm_mul_ps(tableSine, c), _mm_mul_ps(tableCos, s)));
+        _mm_storeu_ps(cosines + i, _mm_sub_ps(_mm_mul_ps(tableCos, c), _mm_mul_ps(tableSine, s)));
+    }
+
+#endif
+
+    for (; i < count; ++i)
+        sinCosDegrees(degrees[i], sines[i], cosines[i]);
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SINCOS_HPP
+#define SFML_SINCOS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Compute the sine and cosine of an angle in degrees
+///
+/// By default this calls std::sin and std::cos on the angle
+/// converted to radians, exactly as the transforms always did.
+///
+/// When SFML_FAST_SINCOS is defined, the angle is instead
+/// reduced exactly to the nearest multiple of 360/256 degrees,
+/// whose sine and cosine come from a table, and the remainder
+/// (less than 0.71 degree) is handled by short polynomials. The
+/// absolute error is then below 1.2e-7 on both results, one
+/// unit in the last place of 1. The default path is less
+/// accurate because the angle is converted to radians in
+/// float: up to 1.5e-6 within two turns, and growing with the
+/// angle beyond. The reduction is exact for angles up to
+/// 368640 degrees; larger angles are first brought into
+/// (-360, 360) with std::fmod, which keeps their sign.
+///
+/// \param degrees Angle, in degrees
+/// \param sine    Receives the sine of the angle
+/// \param cosine  Receives the cosine of the angle
+///
+////////////////////////////////////////////////////////////
+void sinCosDegrees(float degrees, float& sine, float& cosine);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the sines and cosines of an array of angles in degrees
+///
+/// The results are the same as calling sinCosDegrees on every
+/// angle. When SFML_FAST_SINCOS is defined, four angles are
+/// processed at once with SSE2 when it is available.
+///
+/// \param degrees Angles, in degrees
+/// \param sines   Array receiving the sines of the angles
+/// \param cosines Array receiving the cosines of the angles
+/// \param count   Number of angles
+///
+////////////////////////////////////////////////////////////
+void sinCosDegrees(const float* degrees, float* sines, float* cosines, std::size_t count);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_SINCOS_HPP
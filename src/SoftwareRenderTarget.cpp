@@ -0,0 +1,617 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SoftwareRenderTarget.hpp"
+#include "VertexBuffer.hpp"
+#include "Clock.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_SOFTWARE_SSE2
+#endif
+
+
+namespace
+{
+    // Size of the square tiles the target is split into, in pixels
+    const unsigned int tileSize = 64;
+
+    // Tell whether a pixel lying exactly on an edge belongs to the triangle;
+    // of two triangles sharing an edge, exactly one owns the pixels on it
+    inline bool ownsEdge(const float* edge)
+    {
+        return (edge[0] > 0.f) || ((edge[0] == 0.f) && (edge[1] > 0.f));
+    }
+
+    // Blend a vertex color, optionally modulated by a texel, over a pixel
+    inline bool blendPixel(sf::Uint8* pixel, float r, float g, float b, float a)
+    {
+        if (a <= 0.f)
+            return false;
+
+        float alpha   = a / 255.f;
+        float inverse = 1.f - alpha;
+
+        pixel[0] = static_cast<sf::Uint8>(r * alpha + pixel[0] * inverse + 0.5f);
+        pixel[1] = static_cast<sf::Uint8>(g * alpha + pixel[1] * inverse + 0.5f);
+        pixel[2] = static_cast<sf::Uint8>(b * alpha + pixel[2] * inverse + 0.5f);
+        pixel[3] = static_cast<sf::Uint8>(a + pixel[3] * inverse + 0.5f);
+
+        return true;
+    }
+
+    // Compute a blending factor, all the values being in [0, 1]
+    inline float getFactor(sf::BlendMode::Factor factor, float source, float sourceAlpha, float destination, float destinationAlpha)
+    {
+        switch (factor)
+        {
+            case sf::BlendMode::Zero:             return 0.f;
+            case sf::BlendMode::One:              return 1.f;
+            case sf::BlendMode::SrcColor:         return source;
+            case sf::BlendMode::OneMinusSrcColor: return 1.f - source;
+            case sf::BlendMode::DstColor:         return destination;
+            case sf::BlendMode::OneMinusDstColor: return 1.f - destination;
+            case sf::BlendMode::SrcAlpha:         return sourceAlpha;
+            case sf::BlendMode::OneMinusSrcAlpha: return 1.f - sourceAlpha;
+            case sf::BlendMode::DstAlpha:         return destinationAlpha;
+            case sf::BlendMode::OneMinusDstAlpha: return 1.f - destinationAlpha;
+        }
+
+        return 0.f;
+    }
+
+    // Blend one channel of a source color with the pixel, and clamp the result to [0, 1]
+    inline float blendChannel(sf::BlendMode::Factor sourceFactor, sf::BlendMode::Factor destinationFactor,
+                              sf::BlendMode::Equation equation, float source, float sourceAlpha,
+                              float destination, float destinationAlpha)
+    {
+        float s = source * getFactor(sourceFactor, source, sourceAlpha, destination, destinationAlpha);
+        float d = destination * getFactor(destinationFactor, source, sourceAlpha, destination, destinationAlpha);
+
+        float result;
+        switch (equation)
+        {
+            case sf::BlendMode::Subtract:        result = s - d; break;
+            case sf::BlendMode::ReverseSubtract: result = d - s; break;
+            default:                             result = s + d; break;
+        }
+
+        return std::min(std::max(result, 0.f), 1.f);
+    }
+
+    // Blend a vertex color, optionally modulated by a texel, with a pixel
+    // according to any blend mode; slower than the alpha blending above
+    inline bool blendPixel(sf::Uint8* pixel, float r, float g, float b, float a, const sf::BlendMode& mode)
+    {
+        const float source[4] = {r / 255.f, g / 255.f, b / 255.f, a / 255.f};
+        const float destination[4] = {pixel[0] / 255.f, pixel[1] / 255.f, pixel[2] / 255.f, pixel[3] / 255.f};
+
+        for (int i = 0; i < 3; ++i)
+        {
+            float value = blendChannel(mode.colorSrcFactor, mode.colorDstFactor, mode.colorEquation,
+                                       source[i], source[3], destination[i], destination[3]);
+            pixel[i] = static_cast<sf::Uint8>(value * 255.f + 0.5f);
+        }
+
+        float alpha = blendChannel(mode.alphaSrcFactor, mode.alphaDstFactor, mode.alphaEquation,
+                                   source[3], source[3], destination[3], destination[3]);
+        pixel[3] = static_cast<sf::Uint8>(alpha * 255.f + 0.5f);
+
+        return true;
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::SoftwareRenderTarget(unsigned int width, unsigned int height, unsigned int threadCount) :
+m_width        (width),
+m_height       (height),
+m_tilesX       ((width + tileSize - 1) / tileSize),
+m_tilesY       ((height + tileSize - 1) / tileSize),
+m_pixels       (static_cast<std::size_t>(width) * height * 4, 0),
+m_viewTransform(),
+m_viewport     (),
+m_textures     (),
+m_triangles    (),
+m_bins         (),
+m_tilePixels   (m_tilesX * m_tilesY, 0),
+m_threadPool   ((threadCount > 0) ? new priv::ThreadPool(threadCount) : &priv::ThreadPool::getShared())
+{
+    // One set of bins per thread, so that binning needs no synchronization
+    m_bins.resize(m_threadPool->getThreadCount(), std::vector<std::vector<Uint32> >(m_tilesX * m_tilesY));
+
+    Statistics statistics = {0, 0, Time::Zero, 0.f, 0.f};
+    m_statistics = statistics;
+
+    clear();
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::~SoftwareRenderTarget()
+{
+    if (!m_threadPool->isShared())
+        delete m_threadPool;
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2u SoftwareRenderTarget::getSize() const
+{
+    return iVector2u(m_width, m_height);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clear(const iColor& color)
+{
+    m_triangles.clear();
+
+    for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+    {
+        m_pixels[i + 0] = color.r;
+        m_pixels[i + 1] = color.g;
+        m_pixels[i + 2] = color.b;
+        m_pixels[i + 3] = color.a;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::registerTexture(const Texture2D& texture, const Image& image)
+{
+    if ((image.width <= 0) || (image.height <= 0))
+        return;
+
+    Color* colors = LoadImageColors(image);
+    if (!colors)
+        return;
+
+    TextureData& data = m_textures[texture.id];
+    data.width  = static_cast<unsigned int>(image.width);
+    data.height = static_cast<unsigned int>(image.height);
+    data.pixels.resize(static_cast<std::size_t>(data.width) * data.height * 4);
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(data.width) * data.height; ++i)
+    {
+        data.pixels[i * 4 + 0] = colors[i].r;
+        data.pixels[i * 4 + 1] = colors[i].g;
+        data.pixels[i * 4 + 2] = colors[i].b;
+        data.pixels[i * 4 + 3] = colors[i].a;
+    }
+
+    UnloadImageColors(colors);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::unregisterTexture(const Texture2D& texture)
+{
+    m_textures.erase(texture.id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::onDisplay()
+{
+    Clock clock;
+
+    std::size_t tileCount = m_tilePixels.size();
+
+    if (!m_triangles.empty() && (tileCount > 0))
+    {
+        m_threadPool->run(m_bins.size(), [this](std::size_t chunk) { binTriangles(chunk); });
+        m_threadPool->run(tileCount, [this](std::size_t tile) { rasterizeTile(tile); });
+    }
+    else
+    {
+        std::fill(m_tilePixels.begin(), m_tilePixels.end(), 0);
+    }
+
+    Statistics statistics = {m_triangles.size(), 0, clock.getElapsedTime(), 0.f, 0.f};
+    for (std::size_t i = 0; i < tileCount; ++i)
+        statistics.pixelCount += m_tilePixels[i];
+
+    float seconds = statistics.renderTime.asSeconds();
+    if (seconds > 0.f)
+    {
+        statistics.pixelsPerSecond    = statistics.pixelCount / seconds;
+        statistics.trianglesPerSecond = statistics.triangleCount / seconds;
+    }
+
+    m_statistics = statistics;
+    m_triangles.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+const Uint8* SoftwareRenderTarget::getPixels() const
+{
+    return m_pixels.empty() ? NULL : &m_pixels[0];
+}
+
+
+////////////////////////////////////////////////////////////
+const SoftwareRenderTarget::Statistics& SoftwareRenderTarget::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::onViewChanged()
+{
+    // Map the clip space of the view to its viewport, the y axis pointing down
+    IntRect viewport = getViewport(getView());
+    float halfWidth  = viewport.width / 2.f;
+    float halfHeight = viewport.height / 2.f;
+    Transform toViewport(halfWidth, 0.f,         viewport.left + halfWidth,
+                         0.f,       -halfHeight, viewport.top + halfHeight,
+                         0.f,       0.f,         1.f);
+    m_viewTransform = toViewport * getView().getTransform();
+
+    // Nothing is drawn outside of both the viewport and the target
+    IntRect bounds(0, 0, static_cast<int>(m_width), static_cast<int>(m_height));
+    if (!viewport.intersects(bounds, m_viewport))
+        m_viewport = IntRect();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::drawPrimitives(const Vertex* vertices, std::size_t vertexCount,
+                                          PrimitiveType type, const RenderStates& states)
+{
+    const TextureData* texture = NULL;
+    if (states.texture)
+    {
+        std::map<unsigned int, TextureData>::const_iterator it = m_textures.find(states.texture->id);
+        if (it != m_textures.end())
+            texture = &it->second;
+    }
+
+    Transform transform = m_viewTransform * states.transform;
+    const BlendMode& blendMode = states.blendMode;
+
+    switch (type)
+    {
+        case Points:
+        {
+            // One-pixel quad per point, like the rlgl target
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                Vertex corners[4] = {vertices[i], vertices[i], vertices[i], vertices[i]};
+                corners[1].position.y += 1.f;
+                corners[2].position.x += 1.f;
+                corners[2].position.y += 1.f;
+                corners[3].position.x += 1.f;
+
+                addTriangle(corners[0], corners[1], corners[2], transform, texture, blendMode);
+                addTriangle(corners[0], corners[2], corners[3], transform, texture, blendMode);
+            }
+            break;
+        }
+
+        case Lines:
+        {
+            for (std::size_t i = 0; i + 1 < vertexCount; i += 2)
+                addLine(vertices[i], vertices[i + 1], transform, texture, blendMode);
+            break;
+        }
+
+        case LineStrip:
+        {
+            for (std::size_t i = 1; i < vertexCount; ++i)
+                addLine(vertices[i - 1], vertices[i], transform, texture, blendMode);
+            break;
+        }
+
+        case Triangles:
+        {
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+                addTriangle(vertices[i], vertices[i + 1], vertices[i + 2], transform, texture, blendMode);
+            break;
+        }
+
+        case TriangleStrip:
+        {
+            for (std::size_t i = 2; i < vertexCount; ++i)
+                addTriangle(vertices[i - 2], vertices[i - 1], vertices[i], transform, texture, blendMode);
+            break;
+        }
+
+        case TriangleFan:
+        {
+            for (std::size_t i = 2; i < vertexCount; ++i)
+                addTriangle(vertices[0], vertices[i - 1], vertices[i], transform, texture, blendMode);
+            break;
+        }
+
+        case Quads:
+        {
+            for (std::size_t i = 0; i + 3 < vertexCount; i += 4)
+            {
+                addTriangle(vertices[i], vertices[i + 1], vertices[i + 2], transform, texture, blendMode);
+                addTriangle(vertices[i], vertices[i + 2], vertices[i + 3], transform, texture, blendMode);
+            }
+            break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::drawBuffer(const VertexBuffer& vertexBuffer, const RenderStates& states)
+{
+    // The system-memory copy of the buffer is all the rasterizer needs
+    drawPrimitives(&vertexBuffer.m_vertices[0], vertexBuffer.m_vertices.size(), vertexBuffer.m_primitiveType, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::addTriangle(const Vertex& a, const Vertex& b, const Vertex& c, const Transform& transform,
+                                       const TextureData* texture, const BlendMode& blendMode)
+{
+    Triangle triangle;
+    triangle.vertices[0] = a;
+    triangle.vertices[1] = b;
+    triangle.vertices[2] = c;
+    triangle.texture     = texture;
+    triangle.blendMode   = blendMode;
+
+    for (int i = 0; i < 3; ++i)
+        triangle.vertices[i].position = transform.transformPoint(triangle.vertices[i].position);
+
+    const iVector2f& p0 = triangle.vertices[0].position;
+    iVector2f p1 = triangle.vertices[1].position;
+    iVector2f p2 = triangle.vertices[2].position;
+
+    // Make the area positive, so that the inside is where every edge function is positive
+    float area = (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x);
+    if (!(area != 0.f) || !std::isfinite(area))
+        return;
+
+    if (area < 0.f)
+    {
+        std::swap(triangle.vertices[1], triangle.vertices[2]);
+        std::swap(p1, p2);
+        area = -area;
+    }
+
+    triangle.invArea = 1.f / area;
+
+    // Edge i goes through the two vertices other than i, and is positive on the side of vertex i
+    const iVector2f* points[3] = {&p0, &p1, &p2};
+    for (int i = 0; i < 3; ++i)
+    {
+        const iVector2f& from = *points[(i + 1) % 3];
+        const iVector2f& to   = *points[(i + 2) % 3];
+
+        triangle.edges[i][0] = from.y - to.y;
+        triangle.edges[i][1] = to.x - from.x;
+        triangle.edges[i][2] = -(triangle.edges[i][0] * from.x + triangle.edges[i][1] * from.y);
+    }
+
+    // Bounding box, clipped to the viewport
+    float minX = std::min(p0.x, std::min(p1.x, p2.x));
+    float minY = std::min(p0.y, std::min(p1.y, p2.y));
+    float maxX = std::max(p0.x, std::max(p1.x, p2.x));
+    float maxY = std::max(p0.y, std::max(p1.y, p2.y));
+
+    triangle.left   = static_cast<int>(std::max(std::floor(minX), static_cast<float>(m_viewport.left)));
+    triangle.top    = static_cast<int>(std::max(std::floor(minY), static_cast<float>(m_viewport.top)));
+    triangle.right  = static_cast<int>(std::min(std::ceil(maxX), static_cast<float>(m_viewport.left + m_viewport.width)));
+    triangle.bottom = static_cast<int>(std::min(std::ceil(maxY), static_cast<float>(m_viewport.top + m_viewport.height)));
+
+    if ((triangle.left >= triangle.right) || (triangle.top >= triangle.bottom))
+        return;
+
+    m_triangles.push_back(triangle);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::addLine(const Vertex& a, const Vertex& b, const Transform& transform,
+                                   const TextureData* texture, const BlendMode& blendMode)
+{
+    Vertex from = a;
+    Vertex to   = b;
+    from.position = transform.transformPoint(from.position);
+    to.position   = transform.transformPoint(to.position);
+
+    // The width is one pixel in target coordinates, whatever the transform
+    iVector2f direction = to.position - from.position;
+    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    if (length == 0.f)
+        return;
+
+    iVector2f normal(-direction.y / length * 0.5f, direction.x / length * 0.5f);
+
+    Vertex corners[4] = {from, from, to, to};
+    corners[0].position += normal;
+    corners[1].position -= normal;
+    corners[2].position -= normal;
+    corners[3].position += normal;
+
+    addTriangle(corners[0], corners[1], corners[2], Transform::Identity, texture, blendMode);
+    addTriangle(corners[0], corners[2], corners[3], Transform::Identity, texture, blendMode);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::binTriangles(std::size_t chunk)
+{
+    std::vector<std::vector<Uint32> >& bins = m_bins[chunk];
+    for (std::size_t i = 0; i < bins.size(); ++i)
+        bins[i].clear();
+
+    // Each chunk bins a contiguous range of triangles, so that
+    // visiting the chunks in order keeps the drawing order
+    std::size_t count = m_triangles.size();
+    std::size_t first = count * chunk / m_bins.size();
+    std::size_t last  = count * (chunk + 1) / m_bins.size();
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const Triangle& triangle = m_triangles[i];
+
+        unsigned int tileLeft   = triangle.left / tileSize;
+        unsigned int tileTop    = triangle.top / tileSize;
+        unsigned int tileRight  = (triangle.right - 1) / tileSize;
+        unsigned int tileBottom = (triangle.bottom - 1) / tileSize;
+
+        for (unsigned int y = tileTop; y <= tileBottom; ++y)
+            for (unsigned int x = tileLeft; x <= tileRight; ++x)
+                bins[y * m_tilesX + x].push_back(static_cast<Uint32>(i));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::rasterizeTile(std::size_t tile)
+{
+    int tileLeft   = static_cast<int>((tile % m_tilesX) * tileSize);
+    int tileTop    = static_cast<int>((tile / m_tilesX) * tileSize);
+    int tileRight  = std::min(tileLeft + static_cast<int>(tileSize), static_cast<int>(m_width));
+    int tileBottom = std::min(tileTop + static_cast<int>(tileSize), static_cast<int>(m_height));
+
+    Uint64 pixelCount = 0;
+
+    for (std::size_t chunk = 0; chunk < m_bins.size(); ++chunk)
+    {
+        const std::vector<Uint32>& bin = m_bins[chunk][tile];
+
+        for (std::size_t t = 0; t < bin.size(); ++t)
+        {
+            const Triangle& triangle = m_triangles[bin[t]];
+            const Vertex*   v        = triangle.vertices;
+
+            int left   = std::max(triangle.left, tileLeft);
+            int top    = std::max(triangle.top, tileTop);
+            int right  = std::min(triangle.right, tileRight);
+            int bottom = std::min(triangle.bottom, tileBottom);
+
+            bool owns[3] = {ownsEdge(triangle.edges[0]), ownsEdge(triangle.edges[1]), ownsEdge(triangle.edges[2])};
+            bool alphaBlending = (triangle.blendMode == BlendAlpha);
+
+            for (int y = top; y < bottom; ++y)
+            {
+                float centerY = y + 0.5f;
+                Uint8* row = &m_pixels[(static_cast<std::size_t>(y) * m_width) * 4];
+
+                for (int x = left; x < right; x += 4)
+                {
+                    // Evaluate the three edge functions at four pixel centers at once
+                    float weights[3][4];
+                    int   mask = 0;
+
+#ifdef SFML_SOFTWARE_SSE2
+                    __m128 centerX = _mm_add_ps(_mm_set1_ps(x + 0.5f), _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+                    __m128 inside  = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        const float* edge = triangle.edges[i];
+                        __m128 w = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(edge[0]), centerX),
+                                              _mm_set1_ps(edge[1] * centerY + edge[2]));
+
+                        __m128 test = owns[i] ? _mm_cmpge_ps(w, _mm_setzero_ps()) : _mm_cmpgt_ps(w, _mm_setzero_ps());
+                        inside = _mm_and_ps(inside, test);
+                        _mm_storeu_ps(weights[i], w);
+                    }
+
+                    mask = _mm_movemask_ps(inside);
+#else
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        bool covered = true;
+                        for (int i = 0; i < 3; ++i)
+                        {
+                            const float* edge = triangle.edges[i];
+                            float w = edge[0] * (x + k + 0.5f) + edge[1] * centerY + edge[2];
+                            weights[i][k] = w;
+                            covered = covered && (owns[i] ? (w >= 0.f) : (w > 0.f));
+                        }
+
+                        if (covered)
+                            mask |= 1 << k;
+                    }
+#endif
+
+                    if (mask == 0)
+                        continue;
+
+                    for (int k = 0; (k < 4) && (x + k < right); ++k)
+                    {
+                        if (!(mask & (1 << k)))
+                            continue;
+
+                        // Barycentric interpolation of the vertex attributes
+                        float l0 = weights[0][k] * triangle.invArea;
+                        float l1 = weights[1][k] * triangle.invArea;
+                        float l2 = 1.f - l0 - l1;
+
+                        float r = l0 * v[0].color.r + l1 * v[1].color.r + l2 * v[2].color.r;
+                        float g = l0 * v[0].color.g + l1 * v[1].color.g + l2 * v[2].color.g;
+                        float b = l0 * v[0].color.b + l1 * v[1].color.b + l2 * v[2].color.b;
+                        float a = l0 * v[0].color.a + l1 * v[1].color.a + l2 * v[2].color.a;
+
+                        if (triangle.texture)
+                        {
+                            // Nearest texel, clamped to the edges of the image
+                            const TextureData& texture = *triangle.texture;
+                            float u  = l0 * v[0].texCoords.x + l1 * v[1].texCoords.x + l2 * v[2].texCoords.x;
+                            float tv = l0 * v[0].texCoords.y + l1 * v[1].texCoords.y + l2 * v[2].texCoords.y;
+
+                            int tx = std::min(std::max(static_cast<int>(std::floor(u)), 0), static_cast<int>(texture.width) - 1);
+                            int ty = std::min(std::max(static_cast<int>(std::floor(tv)), 0), static_cast<int>(texture.height) - 1);
+                            const Uint8* texel = &texture.pixels[(static_cast<std::size_t>(ty) * texture.width + tx) * 4];
+
+                            r *= texel[0] / 255.f;
+                            g *= texel[1] / 255.f;
+                            b *= texel[2] / 255.f;
+                            a *= texel[3] / 255.f;
+                        }
+
+                        Uint8* pixel = row + (x + k) * 4;
+                        if (alphaBlending ? blendPixel(pixel, r, g, b, a) : blendPixel(pixel, r, g, b, a, triangle.blendMode))
+                            ++pixelCount;
+                    }
+                }
+            }
+        }
+    }
+
+    m_tilePixels[tile] = pixelCount;
+}
+
+} // namespace sf
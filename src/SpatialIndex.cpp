@@ -0,0 +1,476 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SpatialIndex.hpp"
+#include "View.hpp"
+#include <algorithm>
+#include <cassert>
+
+
+namespace
+{
+    // Smallest box enclosing two boxes
+    template <typename Box>
+    Box combine(const Box& a, const Box& b)
+    {
+        Box box;
+        box.left   = std::min(a.left, b.left);
+        box.top    = std::min(a.top, b.top);
+        box.right  = std::max(a.right, b.right);
+        box.bottom = std::max(a.bottom, b.bottom);
+        return box;
+    }
+
+    // Half the perimeter of a box: the cost of a node for the insertion heuristic
+    template <typename Box>
+    float getCost(const Box& box)
+    {
+        return (box.right - box.left) + (box.bottom - box.top);
+    }
+
+    // Whether a box contains another one
+    template <typename Box>
+    bool contains(const Box& outer, const Box& inner)
+    {
+        return (outer.left <= inner.left) && (outer.top <= inner.top) &&
+               (outer.right >= inner.right) && (outer.bottom >= inner.bottom);
+    }
+
+    // Whether two boxes overlap; touching boxes do
+    template <typename Box>
+    bool overlaps(const Box& a, const Box& b)
+    {
+        return (a.left <= b.right) && (a.right >= b.left) &&
+               (a.top <= b.bottom) && (a.bottom >= b.top);
+    }
+
+    // Box of a rectangle enlarged by a margin on every side
+    template <typename Box>
+    Box makeBox(const sf::FloatRect& rect, float margin)
+    {
+        Box box;
+        box.left   = rect.left - margin;
+        box.top    = rect.top - margin;
+        box.right  = rect.left + rect.width + margin;
+        box.bottom = rect.top + rect.height + margin;
+        return box;
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialIndex::SpatialIndex(float margin) :
+m_nodes     (),
+m_root      (NullEntry),
+m_freeList  (NullEntry),
+m_entryCount(0),
+m_margin    (margin)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+int SpatialIndex::insert(const FloatRect& bounds, void* userData)
+{
+    int leaf = allocateNode();
+    m_nodes[leaf].box      = makeBox<Box>(bounds, m_margin);
+    m_nodes[leaf].userData = userData;
+    m_nodes[leaf].height   = 0;
+
+    insertLeaf(leaf);
+    ++m_entryCount;
+
+    return leaf;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::remove(int entry)
+{
+    assert((entry >= 0) && (entry < static_cast<int>(m_nodes.size())) && (m_nodes[entry].height == 0));
+
+    removeLeaf(entry);
+    freeNode(entry);
+    --m_entryCount;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpatialIndex::update(int entry, const FloatRect& bounds)
+{
+    assert((entry >= 0) && (entry < static_cast<int>(m_nodes.size())) && (m_nodes[entry].height == 0));
+
+    // Small moves stay within the enlarged bounds
+    if (contains(m_nodes[entry].box, makeBox<Box>(bounds, 0.f)))
+        return false;
+
+    removeLeaf(entry);
+    m_nodes[entry].box = makeBox<Box>(bounds, m_margin);
+    insertLeaf(entry);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::clear()
+{
+    m_nodes.clear();
+    m_root       = NullEntry;
+    m_freeList   = NullEntry;
+    m_entryCount = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void* SpatialIndex::getUserData(int entry) const
+{
+    return m_nodes[entry].userData;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpatialIndex::getFatBounds(int entry) const
+{
+    const Box& box = m_nodes[entry].box;
+    return FloatRect(box.left, box.top, box.right - box.left, box.bottom - box.top);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::getEntryCount() const
+{
+    return m_entryCount;
+}
+
+
+////////////////////////////////////////////////////////////
+int SpatialIndex::getHeight() const
+{
+    return (m_root != NullEntry) ? m_nodes[m_root].height : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const FloatRect& area, std::vector<void*>& results) const
+{
+    return query(makeBox<Box>(area, 0.f), results);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const iVector2f& point, std::vector<void*>& results) const
+{
+    Box box = {point.x, point.y, point.x, point.y};
+    return query(box, results);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const View& view, std::vector<void*>& results) const
+{
+    // The visible area is the clip-space square brought back to the world
+    return query(view.getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f)), results);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const Box& box, std::vector<void*>& results) const
+{
+    if (m_root == NullEntry)
+        return 0;
+
+    std::size_t count = 0;
+
+    // Depth-first traversal; a balanced tree keeps the stack short
+    int stack[128];
+    std::vector<int> overflow;
+    int size = 0;
+    stack[size++] = m_root;
+
+    while (size > 0)
+    {
+        int index = stack[--size];
+        const Node& node = m_nodes[index];
+
+        if (!overlaps(node.box, box))
+            continue;
+
+        if (node.height == 0)
+        {
+            results.push_back(node.userData);
+            ++count;
+        }
+        else if (size + 2 <= 128)
+        {
+            stack[size++] = node.children[0];
+            stack[size++] = node.children[1];
+        }
+        else
+        {
+            // Too deep for the fixed stack (only for pathological trees)
+            overflow.push_back(node.children[0]);
+            overflow.push_back(node.children[1]);
+        }
+
+        if ((size == 0) && !overflow.empty())
+        {
+            stack[size++] = overflow.back();
+            overflow.pop_back();
+        }
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+int SpatialIndex::allocateNode()
+{
+    // Grow the pool when there's no unused node left
+    if (m_freeList == NullEntry)
+    {
+        std::size_t oldSize = m_nodes.size();
+        std::size_t newSize = std::max<std::size_t>(oldSize * 2, 16);
+        m_nodes.resize(newSize);
+
+        for (std::size_t i = oldSize; i < newSize; ++i)
+        {
+            m_nodes[i].parent = (i + 1 < newSize) ? static_cast<int>(i + 1) : NullEntry;
+            m_nodes[i].height = -1;
+        }
+
+        m_freeList = static_cast<int>(oldSize);
+    }
+
+    int index = m_freeList;
+    Node& node = m_nodes[index];
+    m_freeList = node.parent;
+
+    node.userData    = NULL;
+    node.parent      = NullEntry;
+    node.children[0] = NullEntry;
+    node.children[1] = NullEntry;
+    node.height      = 0;
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::freeNode(int node)
+{
+    m_nodes[node].parent = m_freeList;
+    m_nodes[node].height = -1;
+    m_freeList = node;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::insertLeaf(int leaf)
+{
+    if (m_root == NullEntry)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = NullEntry;
+        return;
+    }
+
+    // Walk down to the sibling whose pairing with the leaf costs the least,
+    // the cost of a node being the half perimeter of its box
+    const Box& leafBox = m_nodes[leaf].box;
+    int index = m_root;
+    while (m_nodes[index].height > 0)
+    {
+        const Node& node = m_nodes[index];
+
+        float cost         = getCost(node.box);
+        float combinedCost = getCost(combine(node.box, leafBox));
+
+        // Cost of making a new parent for this node and the leaf
+        float siblingCost = 2.f * combinedCost;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.f * (combinedCost - cost);
+
+        float childCosts[2];
+        for (int i = 0; i < 2; ++i)
+        {
+            const Node& child = m_nodes[node.children[i]];
+            float enlarged = getCost(combine(child.box, leafBox));
+            childCosts[i] = ((child.height == 0) ? enlarged : enlarged - getCost(child.box)) + inheritanceCost;
+        }
+
+        if ((siblingCost < childCosts[0]) && (siblingCost < childCosts[1]))
+            break;
+
+        index = (childCosts[0] < childCosts[1]) ? node.children[0] : node.children[1];
+    }
+
+    // Create a new parent for the sibling and the leaf
+    int sibling   = index;
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+
+    Node& parent = m_nodes[newParent];
+    parent.parent      = oldParent;
+    parent.box         = combine(m_nodes[sibling].box, m_nodes[leaf].box);
+    parent.height      = m_nodes[sibling].height + 1;
+    parent.children[0] = sibling;
+    parent.children[1] = leaf;
+
+    if (oldParent != NullEntry)
+    {
+        int* children = m_nodes[oldParent].children;
+        children[(children[0] == sibling) ? 0 : 1] = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent    = newParent;
+
+    refreshAncestors(newParent);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::removeLeaf(int leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = NullEntry;
+        return;
+    }
+
+    // The sibling takes the place of the parent
+    int parent      = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling     = (m_nodes[parent].children[0] == leaf) ? m_nodes[parent].children[1] : m_nodes[parent].children[0];
+
+    if (grandParent != NullEntry)
+    {
+        int* children = m_nodes[grandParent].children;
+        children[(children[0] == parent) ? 0 : 1] = sibling;
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        refreshAncestors(grandParent);
+    }
+    else
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = NullEntry;
+        freeNode(parent);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::refreshAncestors(int node)
+{
+    while (node != NullEntry)
+    {
+        node = balance(node);
+
+        Node& current = m_nodes[node];
+        const Node& first  = m_nodes[current.children[0]];
+        const Node& second = m_nodes[current.children[1]];
+
+        current.height = 1 + std::max(first.height, second.height);
+        current.box    = combine(first.box, second.box);
+
+        node = current.parent;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int SpatialIndex::balance(int a)
+{
+    // Rotate the taller child up when the heights of the children
+    // differ by more than one, as in an AVL tree
+    Node& nodeA = m_nodes[a];
+    if (nodeA.height < 2)
+        return a;
+
+    int b = nodeA.children[0];
+    int c = nodeA.children[1];
+    int difference = m_nodes[c].height - m_nodes[b].height;
+
+    if ((difference >= -1) && (difference <= 1))
+        return a;
+
+    // Make c the taller child, and its slot in a the one to replace
+    int slot = 1;
+    if (difference < 0)
+    {
+        std::swap(b, c);
+        slot = 0;
+    }
+
+    Node& nodeC = m_nodes[c];
+    int f = nodeC.children[0];
+    int g = nodeC.children[1];
+
+    // c takes the place of a
+    nodeC.children[0] = a;
+    nodeC.parent      = nodeA.parent;
+    nodeA.parent      = c;
+
+    if (nodeC.parent != NullEntry)
+    {
+        int* children = m_nodes[nodeC.parent].children;
+        children[(children[0] == a) ? 0 : 1] = c;
+    }
+    else
+    {
+        m_root = c;
+    }
+
+    // The taller grandchild stays under c, the other one moves under a
+    if (m_nodes[f].height < m_nodes[g].height)
+        std::swap(f, g);
+
+    nodeC.children[1]    = f;
+    nodeA.children[slot] = g;
+    m_nodes[g].parent    = a;
+
+    nodeA.box    = combine(m_nodes[b].box, m_nodes[g].box);
+    nodeA.height = 1 + std::max(m_nodes[b].height, m_nodes[g].height);
+    nodeC.box    = combine(nodeA.box, m_nodes[f].box);
+    nodeC.height = 1 + std::max(nodeA.height, m_nodes[f].height);
+
+    return c;
+}
+
+} // namespace sf
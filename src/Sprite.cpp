@@ -25,9 +25,8 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include <raylib.h>
-#include <rlgl.h>
 #include "Sprite.hpp"
+#include "RenderTarget.hpp"
 #include <cstdlib>
 #include <cstdio>
 
@@ -39,13 +38,13 @@ Sprite::Sprite() :
 m_textureRect()
 {
     m_texture = {0};
-    m_texture.id=-1;
+    m_texture.id=0;
 
 }
 
 
 ////////////////////////////////////////////////////////////
-Sprite::Sprite( Texture2D& texture) :
+Sprite::Sprite(const Texture2D& texture) :
 m_textureRect()
 {
     setTexture(texture);
@@ -53,7 +52,7 @@ m_textureRect()
 
 
 ////////////////////////////////////////////////////////////
-Sprite::Sprite( Texture2D& texture, const IntRect& rectangle) :
+Sprite::Sprite(const Texture2D& texture, const IntRect& rectangle) :
 m_textureRect()
 {
     setTexture(texture);
@@ -62,7 +61,7 @@ m_textureRect()
 
 
 ////////////////////////////////////////////////////////////
-void Sprite::setTexture( Texture2D& texture, bool resetRect)
+void Sprite::setTexture(const Texture2D& texture, bool resetRect)
 {
     // Recompute the texture area if requested, or if there was no valid texture & rect before
     if (resetRect)// || (m_textureRect == sf::IntRect()))
@@ -135,77 +134,14 @@ FloatRect Sprite::getGlobalBounds() const
 
 
 ////////////////////////////////////////////////////////////
-void Sprite::draw() const
+void Sprite::draw(RenderTarget& target, RenderStates states) const
 {
+    states.transform *= getTransform();
+    if (target.cull(states.transform.transformRect(getLocalBounds())))
+        return;
 
-
-        rlPushMatrix();
-        rlMultMatrixf((float*)getTransform().getMatrix());
-
-
-
-
-
-
-       rlCheckRenderBatchLimit(4);
-
-
-            if (m_texture.id>0)
-               rlSetTexture(m_texture.id);
-            else
-                rlSetTexture(0);
-
-
-            rlBegin(RL_QUADS);
-
-
-
-
-
-
-
-
-                Vector2 v0=(Vector2){m_vertices[0].position.x,m_vertices[0].position.y};
-                Vector2 v1=(Vector2){m_vertices[1].position.x,m_vertices[1].position.y};
-                Vector2 v2=(Vector2){m_vertices[3].position.x,m_vertices[3].position.y};
-                Vector2 v3=(Vector2){m_vertices[2].position.x,m_vertices[2].position.y};
-
-                Vector2 t0=(Vector2){m_vertices[0].texCoords.x,m_vertices[0].texCoords.y};
-                Vector2 t1=(Vector2){m_vertices[1].texCoords.x,m_vertices[1].texCoords.y};
-                Vector2 t2=(Vector2){m_vertices[3].texCoords.x,m_vertices[3].texCoords.y};
-                Vector2 t3=(Vector2){m_vertices[2].texCoords.x,m_vertices[2].texCoords.y};
-
-                 iColor c0 =m_vertices[0].color;
-                 iColor c1 =m_vertices[1].color;
-                 iColor c2 =m_vertices[3].color;
-                 iColor c3 =m_vertices[2].color;
-
-
-                rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlColor4ub(c3.r,c3.g,c3.b,c3.a);
-
-
-                rlTexCoord2f(t0.x,t0.y);
-                rlVertex2f(v0.x, v0.y);
-
-
-                rlTexCoord2f(t1.x,t1.y);
-                rlVertex2f(v1.x, v1.y);
-
-
-                rlTexCoord2f(t2.x,t2.y);
-                rlVertex2f(v2.x, v2.y);
-
-                rlTexCoord2f(t3.x,t3.y);
-                rlVertex2f(v3.x, v3.y);
-
-        rlEnd();
-
-
-   rlPopMatrix();
-
+    states.texture = (m_texture.id > 0) ? &m_texture : NULL;
+    target.draw(m_vertices, 4, TriangleStrip, states);
 }
 
 
@@ -224,30 +160,6 @@ void Sprite::updatePositions()
 ////////////////////////////////////////////////////////////
 void Sprite::updateTexCoords()
 {
-    float width  = (float)m_textureRect.width;
-    float height = (float)m_textureRect.height;
-
-    float left   = static_cast<float>(m_textureRect.left);
-    float right  = m_textureRect.width;
-    float top    = static_cast<float>(m_textureRect.top);
-    float bottom = m_textureRect.height;
-
-
-     Rectangle source=(Rectangle){left,top,width,height};
-
-    m_vertices[0].texCoords = iVector2f(source.x/width, source.y/height);
-
-    m_vertices[1].texCoords = iVector2f(source.x/width, (source.y + source.height)/height);
-
-    m_vertices[3].texCoords = iVector2f((source.x + source.width)/width, (source.y + source.height)/height);
-
-    m_vertices[2].texCoords =  iVector2f((source.x + source.width)/width, source.y/height);
-
-
-
-/*
-
-
     float left   = static_cast<float>(m_textureRect.left);
     float right  = left + m_textureRect.width;
     float top    = static_cast<float>(m_textureRect.top);
@@ -257,20 +169,6 @@ void Sprite::updateTexCoords()
     m_vertices[1].texCoords = iVector2f(left, bottom);
     m_vertices[2].texCoords = iVector2f(right, top);
     m_vertices[3].texCoords = iVector2f(right, bottom);
-
-
-
-                Vector2 t0=(Vector2){m_vertices[0].texCoords.x,m_vertices[0].texCoords.y};
-                Vector2 t1=(Vector2){m_vertices[1].texCoords.x,m_vertices[1].texCoords.y};
-                Vector2 t2=(Vector2){m_vertices[2].texCoords.x,m_vertices[2].texCoords.y};
-                Vector2 t3=(Vector2){m_vertices[3].texCoords.x,m_vertices[3].texCoords.y};
-
-
-                 printf("1 %f %f \n",t0.x,t0.y);
-                 printf("2 %f %f \n",t1.x,t1.y);
-                 printf("3 %f %f \n",t2.x,t2.y);
-                 printf("4 %f %f \n",t3.x,t3.y);
-*/
 }
 
 } // namespace sf
@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SpriteBatch.hpp"
+#include "Sprite.hpp"
+#include "Shape.hpp"
+#include "VertexArray.hpp"
+#include "RenderTarget.hpp"
+
+
+namespace
+{
+    // Sentinel meaning "no texture bound yet"
+    const unsigned int noTexture = static_cast<unsigned int>(-1);
+
+    // Append a vertex, with its position transformed
+    inline void appendVertex(std::vector<sf::Vertex>& out, const sf::Vertex& vertex, const sf::Transform& transform)
+    {
+        out.push_back(sf::Vertex(transform.transformPoint(vertex.position), vertex.color, vertex.texCoords));
+    }
+
+    // Append a triangle made of three vertices of an array
+    inline void appendTriangle(std::vector<sf::Vertex>& out, const sf::Vertex* vertices,
+                               std::size_t a, std::size_t b, std::size_t c, const sf::Transform& transform)
+    {
+        appendVertex(out, vertices[a], transform);
+        appendVertex(out, vertices[b], transform);
+        appendVertex(out, vertices[c], transform);
+    }
+
+    // Append a whole array of vertices at once
+    inline void appendVertices(std::vector<sf::Vertex>& out, const sf::Vertex* vertices,
+                               std::size_t count, const sf::Transform& transform)
+    {
+        std::size_t first = out.size();
+        out.resize(first + count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sf::Vertex& vertex = out[first + i];
+            vertex.position  = transform.transformPoint(vertices[i].position);
+            vertex.color     = vertices[i].color;
+            vertex.texCoords = vertices[i].texCoords;
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch() :
+m_groups        (),
+m_groupIndices  (),
+m_itemCount     (0),
+m_naiveDrawCalls(0),
+m_naiveSwitches (0),
+m_lastTexture   (noTexture)
+{
+    Statistics statistics = {0, 0, 0, 0, 0, 0};
+    m_statistics = statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    for (std::size_t i = 0; i < m_groups.size(); ++i)
+        m_groups[i].vertices.clear();
+
+    m_itemCount      = 0;
+    m_naiveDrawCalls = 0;
+    m_naiveSwitches  = 0;
+    m_lastTexture    = noTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::add(const Sprite& sprite)
+{
+    const Texture2D* texture = (sprite.m_texture.id > 0) ? &sprite.m_texture : NULL;
+    const Transform& transform = sprite.getTransform();
+    std::vector<Vertex>& out = getGroup(texture, Triangles);
+
+    // The sprite is a triangle strip: top-left, bottom-left, top-right, bottom-right
+    appendTriangle(out, sprite.m_vertices, 0, 1, 3, transform);
+    appendTriangle(out, sprite.m_vertices, 0, 3, 2, transform);
+
+    ++m_itemCount;
+    registerDrawCall(sprite.m_texture.id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::add(const Shape& shape)
+{
+    shape.updateIfNeeded();
+
+    const Transform& transform = shape.getTransform();
+
+    // Fill: triangles cached by the shape
+    std::size_t fillCount = shape.m_fillTriangles.getVertexCount();
+    if (fillCount > 0)
+    {
+        const Texture2D* texture = shape.m_useTexture ? &shape.m_texture : NULL;
+        appendVertices(getGroup(texture, Triangles), &shape.m_fillTriangles[0], fillCount, transform);
+
+        registerDrawCall(texture ? texture->id : 0);
+    }
+
+    // Outline: never textured
+    std::size_t outlineCount = shape.m_outlineTriangles.getVertexCount();
+    if ((shape.m_outlineThickness != 0) && (outlineCount > 0))
+    {
+        appendVertices(getGroup(NULL, Triangles), &shape.m_outlineTriangles[0], outlineCount, transform);
+
+        registerDrawCall(0);
+    }
+
+    ++m_itemCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::add(const VertexArray& vertices, const Transform& transform, const Texture2D* texture)
+{
+    std::size_t count = vertices.getVertexCount();
+    if (count == 0)
+        return;
+
+    const Vertex* in = &vertices[0];
+
+    switch (vertices.getPrimitiveType())
+    {
+        case Points:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Points);
+            for (std::size_t i = 0; i < count; ++i)
+                appendVertex(out, in[i], transform);
+            break;
+        }
+
+        case Lines:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Lines);
+            for (std::size_t i = 0; i + 1 < count; i += 2)
+            {
+                appendVertex(out, in[i], transform);
+                appendVertex(out, in[i + 1], transform);
+            }
+            break;
+        }
+
+        case LineStrip:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Lines);
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                appendVertex(out, in[i - 1], transform);
+                appendVertex(out, in[i], transform);
+            }
+            break;
+        }
+
+        case Triangles:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Triangles);
+            for (std::size_t i = 0; i + 2 < count; i += 3)
+                appendTriangle(out, in, i, i + 1, i + 2, transform);
+            break;
+        }
+
+        case TriangleStrip:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Triangles);
+            for (std::size_t i = 2; i < count; ++i)
+                appendTriangle(out, in, i - 2, i - 1, i, transform);
+            break;
+        }
+
+        case TriangleFan:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Triangles);
+            for (std::size_t i = 2; i < count; ++i)
+                appendTriangle(out, in, 0, i - 1, i, transform);
+            break;
+        }
+
+        case Quads:
+        {
+            std::vector<Vertex>& out = getGroup(texture, Triangles);
+            for (std::size_t i = 0; i + 3 < count; i += 4)
+            {
+                appendTriangle(out, in, i, i + 1, i + 2, transform);
+                appendTriangle(out, in, i, i + 2, i + 3, transform);
+            }
+            break;
+        }
+    }
+
+    ++m_itemCount;
+    registerDrawCall(texture ? texture->id : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+const SpriteBatch::Statistics& SpriteBatch::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    Statistics statistics = {m_itemCount, 0, 0, 0, 0, 0};
+
+    // The map is ordered by key, so iterating it visits the groups sorted by texture
+    unsigned int currentTexture = noTexture;
+    for (std::map<Uint64, std::size_t>::const_iterator it = m_groupIndices.begin(); it != m_groupIndices.end(); ++it)
+    {
+        const Group& group = m_groups[it->second];
+        if (group.vertices.empty())
+            continue;
+
+        if (group.texture.id != currentTexture)
+        {
+            currentTexture = group.texture.id;
+            ++statistics.textureSwitches;
+        }
+
+        // The vertices are already transformed, only the transform of the states applies
+        states.texture = (group.texture.id > 0) ? &group.texture : NULL;
+        target.draw(&group.vertices[0], group.vertices.size(), group.type, states);
+
+        statistics.vertexCount += group.vertices.size();
+        ++statistics.drawCalls;
+    }
+
+    statistics.drawCallsSaved       = m_naiveDrawCalls > statistics.drawCalls ? m_naiveDrawCalls - statistics.drawCalls : 0;
+    statistics.textureSwitchesSaved = m_naiveSwitches > statistics.textureSwitches ? m_naiveSwitches - statistics.textureSwitches : 0;
+    m_statistics = statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Vertex>& SpriteBatch::getGroup(const Texture2D* texture, PrimitiveType type)
+{
+    unsigned int id = texture ? texture->id : 0;
+    Uint64 key = (static_cast<Uint64>(id) << 3) | static_cast<Uint64>(type);
+
+    std::map<Uint64, std::size_t>::iterator it = m_groupIndices.find(key);
+    if (it != m_groupIndices.end())
+        return m_groups[it->second].vertices;
+
+    Group group;
+    group.texture = texture ? *texture : Texture2D();
+    group.type    = type;
+    m_groups.push_back(group);
+    m_groupIndices[key] = m_groups.size() - 1;
+
+    return m_groups.back().vertices;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::registerDrawCall(unsigned int texture)
+{
+    ++m_naiveDrawCalls;
+
+    if (texture != m_lastTexture)
+    {
+        ++m_naiveSwitches;
+        m_lastTexture = texture;
+    }
+}
+
+} // namespace sf
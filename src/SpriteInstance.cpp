@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SpriteInstance.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteInstance::SpriteInstance() :
+color(255, 255, 255)
+{
+    matrix[0] = 1.f; matrix[1] = 0.f; matrix[2] = 0.f;
+    matrix[3] = 0.f; matrix[4] = 1.f; matrix[5] = 0.f;
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteInstance::SpriteInstance(const Transform& transform, const iColor& theColor) :
+color(theColor)
+{
+    setTransform(transform);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteInstance::setTransform(const Transform& transform)
+{
+    // The affine matrix is stored by columns
+    const float* m = transform.getAffineMatrix();
+
+    matrix[0] = m[0]; matrix[1] = m[2]; matrix[2] = m[4];
+    matrix[3] = m[1]; matrix[4] = m[3]; matrix[5] = m[5];
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f SpriteInstance::transformPoint(const iVector2f& point) const
+{
+    return iVector2f(matrix[0] * point.x + matrix[1] * point.y + matrix[2],
+                     matrix[3] * point.x + matrix[4] * point.y + matrix[5]);
+}
+
+} // namespace sf
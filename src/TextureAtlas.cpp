@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "TextureAtlas.hpp"
+#include <raylib.h>
+#include <algorithm>
+#include <limits>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding) :
+m_pageSize(static_cast<int>(pageSize)),
+m_padding (static_cast<int>(padding)),
+m_pages   ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas()
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::add(const Image& image, Region& region)
+{
+    if (!image.data || (image.width <= 0) || (image.height <= 0))
+        return false;
+
+    int width  = image.width + 2 * m_padding;
+    int height = image.height + 2 * m_padding;
+    if ((width > m_pageSize) || (height > m_pageSize))
+        return false;
+
+    // Find room in the existing pages, or start a new one
+    IntRect area;
+    std::size_t index = 0;
+    while ((index < m_pages.size()) && !pack(m_pages[index], width, height, area))
+        ++index;
+
+    if (index == m_pages.size())
+    {
+        Image blank = GenImageColor(m_pageSize, m_pageSize, Color{0, 0, 0, 0});
+
+        Page page;
+        page.texture  = LoadTextureFromImage(blank);
+        page.usedArea = 0;
+        SkylineNode node = {0, 0, m_pageSize};
+        page.skyline.push_back(node);
+        m_pages.push_back(page);
+
+        UnloadImage(blank);
+
+        pack(m_pages.back(), width, height, area);
+    }
+
+    // Copy the image and repeat its border pixels in the padding
+    Color* colors = LoadImageColors(image);
+    if (!colors)
+        return false;
+
+    std::vector<Color> pixels(static_cast<std::size_t>(width) * height);
+    for (int y = 0; y < height; ++y)
+    {
+        int sourceY = std::min(std::max(y - m_padding, 0), image.height - 1);
+        for (int x = 0; x < width; ++x)
+        {
+            int sourceX = std::min(std::max(x - m_padding, 0), image.width - 1);
+            pixels[static_cast<std::size_t>(y) * width + x] = colors[sourceY * image.width + sourceX];
+        }
+    }
+
+    UnloadImageColors(colors);
+
+    Page& page = m_pages[index];
+    Rectangle destination = {static_cast<float>(area.left), static_cast<float>(area.top),
+                             static_cast<float>(width), static_cast<float>(height)};
+    UpdateTextureRec(page.texture, destination, &pixels[0]);
+
+    page.usedArea += static_cast<Uint64>(width) * height;
+
+    region.texture = page.texture;
+    region.rect    = IntRect(area.left + m_padding, area.top + m_padding, image.width, image.height);
+    region.page    = index;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::addFromFile(const std::string& filename, Region& region)
+{
+    Image image = LoadImage(filename.c_str());
+    bool added = add(image, region);
+    UnloadImage(image);
+
+    return added;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::clear()
+{
+    for (std::size_t i = 0; i < m_pages.size(); ++i)
+        UnloadTexture(m_pages[i].texture);
+
+    m_pages.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture2D& TextureAtlas::getPageTexture(std::size_t index) const
+{
+    return m_pages[index].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextureAtlas::getOccupancy() const
+{
+    if (m_pages.empty())
+        return 0.f;
+
+    Uint64 used = 0;
+    for (std::size_t i = 0; i < m_pages.size(); ++i)
+        used += m_pages[i].usedArea;
+
+    return static_cast<float>(used) / (static_cast<float>(m_pageSize) * m_pageSize * m_pages.size());
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::pack(Page& page, int width, int height, IntRect& area)
+{
+    std::vector<SkylineNode>& skyline = page.skyline;
+
+    // Find the segment where the bottom of the area is the highest,
+    // preferring the narrowest segment on ties
+    std::size_t bestIndex  = skyline.size();
+    int         bestBottom = std::numeric_limits<int>::max();
+    int         bestWidth  = std::numeric_limits<int>::max();
+    int         bestY      = 0;
+
+    for (std::size_t i = 0; i < skyline.size(); ++i)
+    {
+        int x = skyline[i].x;
+        if (x + width > m_pageSize)
+            break;
+
+        // The area rests on the highest segment it spans
+        int y = 0;
+        int remaining = width;
+        for (std::size_t j = i; remaining > 0; ++j)
+        {
+            y = std::max(y, skyline[j].y);
+            remaining -= skyline[j].width;
+        }
+
+        if (y + height > m_pageSize)
+            continue;
+
+        if ((y + height < bestBottom) || ((y + height == bestBottom) && (skyline[i].width < bestWidth)))
+        {
+            bestIndex  = i;
+            bestBottom = y + height;
+            bestWidth  = skyline[i].width;
+            bestY      = y;
+        }
+    }
+
+    if (bestIndex == skyline.size())
+        return false;
+
+    area = IntRect(skyline[bestIndex].x, bestY, width, height);
+
+    // Raise the skyline over the area
+    SkylineNode node = {area.left, bestY + height, width};
+    skyline.insert(skyline.begin() + bestIndex, node);
+
+    for (std::size_t i = bestIndex + 1; i < skyline.size();)
+    {
+        int previousRight = skyline[i - 1].x + skyline[i - 1].width;
+        if (skyline[i].x >= previousRight)
+            break;
+
+        int shrink = previousRight - skyline[i].x;
+        skyline[i].x     += shrink;
+        skyline[i].width -= shrink;
+
+        if (skyline[i].width > 0)
+            break;
+
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge the neighbor segments at the same height
+    for (std::size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sf
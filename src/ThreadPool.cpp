@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "ThreadPool.hpp"
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned int threadCount) :
+ThreadPool(threadCount, false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned int threadCount, bool shared) :
+m_workers   (),
+m_task      (NULL),
+m_taskCount (0),
+m_nextTask  (0),
+m_generation(0),
+m_busy      (0),
+m_stop      (false),
+m_running   (false),
+m_shared    (shared)
+{
+    if (threadCount == 0)
+        threadCount = std::thread::hardware_concurrency();
+
+    // The calling thread takes part in every loop
+    for (unsigned int i = 1; i < threadCount; ++i)
+        m_workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::size_t i = 0; i < m_workers.size(); ++i)
+        m_workers[i].join();
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool& ThreadPool::getShared()
+{
+    static ThreadPool pool(0, true);
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ThreadPool::isShared() const
+{
+    return m_shared;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ThreadPool::getThreadCount() const
+{
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::run(std::size_t taskCount, const std::function<void(std::size_t)>& task)
+{
+    if (taskCount == 0)
+        return;
+
+    // Not worth waking the workers up for a single task; loops started
+    // while the workers are busy, by another thread or by a task of the
+    // running loop, can't wait for them and run on the calling thread
+    bool idle = false;
+    if (m_workers.empty() || (taskCount == 1) || !m_running.compare_exchange_strong(idle, true))
+    {
+        for (std::size_t i = 0; i < taskCount; ++i)
+            task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task      = &task;
+        m_taskCount = taskCount;
+        m_nextTask  = 0;
+        m_busy      = m_workers.size();
+        ++m_generation;
+    }
+    m_wakeUp.notify_all();
+
+    processTasks();
+
+    // Wait for the workers to leave the loop before the task goes out of scope
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this] { return m_busy == 0; });
+    m_task    = NULL;
+    m_running = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::workerLoop()
+{
+    std::size_t generation = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUp.wait(lock, [&] { return m_stop || (m_generation != generation); });
+
+            if (m_stop)
+                return;
+
+            generation = m_generation;
+        }
+
+        processTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_busy;
+        }
+        m_finished.notify_one();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::processTasks()
+{
+    for (;;)
+    {
+        std::size_t index = m_nextTask.fetch_add(1);
+        if (index >= m_taskCount)
+            break;
+
+        (*m_task)(index);
+    }
+}
+
+} // namespace priv
+
+} // namespace sf
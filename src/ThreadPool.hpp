@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_THREADPOOL_HPP
+#define SFML_THREADPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "NonCopyable.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Fixed set of worker threads running parallel loops
+///
+/// The pool runs one loop at a time: run() splits the indices
+/// [0, taskCount) between the workers and the calling thread,
+/// and returns once every index has been processed. Indices are
+/// handed out one at a time, so tasks of uneven cost are
+/// balanced automatically.
+///
+/// A loop started while another one is running, from another
+/// thread or from one of its tasks, runs on the calling thread
+/// alone. Objects therefore share a single pool (see getShared)
+/// rather than running more threads than there are cores.
+///
+////////////////////////////////////////////////////////////
+class ThreadPool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threadCount Total number of threads running the loops,
+    ///                    including the calling one; 0 to use one
+    ///                    thread per hardware core
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop and join the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pool shared by the whole library
+    ///
+    /// The pool has one thread per hardware core, and is started
+    /// on the first call.
+    ///
+    /// \return Shared pool
+    ///
+    ////////////////////////////////////////////////////////////
+    static ThreadPool& getShared();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether this is the shared pool
+    ///
+    /// \return True if the pool was returned by getShared
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isShared() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads running the loops
+    ///
+    /// \return Number of workers plus the calling thread
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for every index of a range, in parallel
+    ///
+    /// \param taskCount Number of indices
+    /// \param task      Function called with each index of [0, taskCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    void run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threadCount Total number of threads, 0 for one per core
+    /// \param shared      Is this the shared pool?
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool(unsigned int threadCount, bool shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry point of the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void workerLoop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process indices of the current loop until none is left
+    ///
+    ////////////////////////////////////////////////////////////
+    void processTasks();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::thread>                  m_workers;    ///< Worker threads
+    std::mutex                                m_mutex;      ///< Protects the loop description below
+    std::condition_variable                   m_wakeUp;     ///< Signals the workers that a loop started, or that they must stop
+    std::condition_variable                   m_finished;   ///< Signals the caller that every worker left the loop
+    const std::function<void(std::size_t)>*   m_task;       ///< Function of the current loop
+    std::size_t                               m_taskCount;  ///< Number of indices of the current loop
+    std::atomic<std::size_t>                  m_nextTask;   ///< Next index to process
+    std::size_t                               m_generation; ///< Incremented for every loop, so that workers run each loop once
+    std::size_t                               m_busy;       ///< Number of workers still inside the current loop
+    bool                                      m_stop;       ///< Tells the workers to exit
+    std::atomic<bool>                         m_running;    ///< Is a loop using the workers?
+    bool                                      m_shared;     ///< Is this the shared pool?
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_THREADPOOL_HPP
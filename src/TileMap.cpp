@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "TileMap.hpp"
+#include "RenderTarget.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Slot index of a chunk that has no cached geometry
+    const std::size_t NoSlot = static_cast<std::size_t>(-1);
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::Slot::Slot() :
+vertices (Quads, VertexBuffer::Dynamic),
+chunk    (0),
+lastDrawn(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap(unsigned int chunkSize) :
+m_tileset    (),
+m_tileSize   (),
+m_size       (),
+m_chunkSize  (std::max(chunkSize, 1u)),
+m_chunkCount (),
+m_tiles      (),
+m_cacheBudget(64),
+m_chunkSlots (),
+m_slots      (),
+m_scratch    (),
+m_drawCount  (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool TileMap::load(const Texture2D& tileset, const iVector2u& tileSize, const int* tiles, unsigned int width, unsigned int height)
+{
+    if ((tileSize.x == 0) || (tileSize.y == 0) || (width == 0) || (height == 0))
+        return false;
+
+    m_tileset    = tileset;
+    m_tileSize   = tileSize;
+    m_size       = iVector2u(width, height);
+    m_chunkCount = iVector2u((width + m_chunkSize - 1) / m_chunkSize, (height + m_chunkSize - 1) / m_chunkSize);
+    m_tiles.assign(tiles, tiles + static_cast<std::size_t>(width) * height);
+
+    // The geometry is built when the chunks become visible
+    releaseSlots();
+    m_chunkSlots.assign(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y, NoSlot);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(unsigned int x, unsigned int y, int tile)
+{
+    if ((x >= m_size.x) || (y >= m_size.y))
+        return;
+
+    m_tiles[x + static_cast<std::size_t>(y) * m_size.x] = tile;
+
+    // Chunks without geometry will see the new tile when they are built
+    std::size_t chunk = (x / m_chunkSize) + static_cast<std::size_t>(y / m_chunkSize) * m_chunkCount.x;
+    std::size_t slot  = m_chunkSlots[chunk];
+    if (slot == NoSlot)
+        return;
+
+    Vertex quad[4];
+    getQuad(quad, x, y);
+
+    std::size_t offset = ((x % m_chunkSize) + (y % m_chunkSize) * m_chunkSize) * 4;
+    m_slots[slot].vertices.update(quad, 4, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+int TileMap::getTile(unsigned int x, unsigned int y) const
+{
+    if ((x >= m_size.x) || (y >= m_size.y))
+        return -1;
+
+    return m_tiles[x + static_cast<std::size_t>(y) * m_size.x];
+}
+
+
+////////////////////////////////////////////////////////////
+const iVector2u& TileMap::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const iVector2u& TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setCacheBudget(std::size_t chunkCount)
+{
+    if (chunkCount < m_slots.size())
+        releaseSlots();
+
+    m_cacheBudget = chunkCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getCacheBudget() const
+{
+    return m_cacheBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getCachedChunkCount() const
+{
+    return m_slots.size();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return FloatRect(0.f, 0.f, static_cast<float>(m_size.x * m_tileSize.x), static_cast<float>(m_size.y * m_tileSize.y));
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_tiles.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture = &m_tileset;
+    ++m_drawCount;
+
+    // The visible area is the clip-space square brought back to the world,
+    // then to the local coordinates of the map
+    FloatRect visible = target.getView().getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+    visible = states.transform.getInverse().transformRect(visible);
+
+    // Range of chunks overlapping it
+    float chunkWidth  = static_cast<float>(m_chunkSize * m_tileSize.x);
+    float chunkHeight = static_cast<float>(m_chunkSize * m_tileSize.y);
+
+    float left   = std::max(std::floor(visible.left / chunkWidth), 0.f);
+    float top    = std::max(std::floor(visible.top / chunkHeight), 0.f);
+    float right  = std::min(std::floor((visible.left + visible.width) / chunkWidth) + 1.f, static_cast<float>(m_chunkCount.x));
+    float bottom = std::min(std::floor((visible.top + visible.height) / chunkHeight) + 1.f, static_cast<float>(m_chunkCount.y));
+
+    // Nothing to draw if the view is away from the map, or isn't finite;
+    // past this test the bounds are within [0, chunk count] and can be cast
+    if (!(left < right) || !(top < bottom))
+        return;
+
+    for (unsigned int y = static_cast<unsigned int>(top); y < bottom; ++y)
+    {
+        for (unsigned int x = static_cast<unsigned int>(left); x < right; ++x)
+        {
+            Slot& slot = acquireSlot(x + static_cast<std::size_t>(y) * m_chunkCount.x);
+            slot.lastDrawn = m_drawCount;
+
+            target.draw(slot.vertices, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::Slot& TileMap::acquireSlot(std::size_t chunk) const
+{
+    std::size_t index = m_chunkSlots[chunk];
+    if (index != NoSlot)
+        return m_slots[index];
+
+    SFML_PROFILE_SCOPE("TileMap::buildChunk");
+
+    if (m_slots.size() < m_cacheBudget)
+    {
+        index = m_slots.size();
+    }
+    else
+    {
+        // Evict the chunk drawn the longest time ago, unless it is part of this draw
+        index = 0;
+        for (std::size_t i = 1; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].lastDrawn < m_slots[index].lastDrawn)
+                index = i;
+        }
+
+        if (m_slots.empty() || (m_slots[index].lastDrawn == m_drawCount))
+            index = m_slots.size();
+        else
+            m_chunkSlots[m_slots[index].chunk] = NoSlot;
+    }
+
+    // Copying a vertex buffer drops its GPU storage: the slots live in a
+    // deque, which doesn't move them when growing, even past the budget
+    if (index == m_slots.size())
+        m_slots.emplace_back();
+
+    // Build one quad per cell of the chunk, including the cells past
+    // the edges of the map, so that every chunk has the same layout
+    unsigned int chunkX = static_cast<unsigned int>(chunk % m_chunkCount.x) * m_chunkSize;
+    unsigned int chunkY = static_cast<unsigned int>(chunk / m_chunkCount.x) * m_chunkSize;
+
+    m_scratch.resize(static_cast<std::size_t>(m_chunkSize) * m_chunkSize * 4);
+    for (unsigned int y = 0; y < m_chunkSize; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkSize; ++x)
+            getQuad(&m_scratch[(x + y * m_chunkSize) * 4], chunkX + x, chunkY + y);
+    }
+
+    Slot& slot = m_slots[index];
+    slot.vertices.update(&m_scratch[0], m_scratch.size(), 0);
+    slot.chunk = chunk;
+    m_chunkSlots[chunk] = index;
+
+    return slot;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::releaseSlots()
+{
+    m_slots.clear();
+    std::fill(m_chunkSlots.begin(), m_chunkSlots.end(), NoSlot);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::getQuad(Vertex* quad, unsigned int x, unsigned int y) const
+{
+    int tile = getTile(x, y);
+
+    float left   = static_cast<float>(x * m_tileSize.x);
+    float top    = static_cast<float>(y * m_tileSize.y);
+    float right  = left + m_tileSize.x;
+    float bottom = top + m_tileSize.y;
+
+    // Empty cells get a quad with no area, so that the layout stays the same
+    unsigned int columns = (m_tileset.width > 0) ? static_cast<unsigned int>(m_tileset.width) / m_tileSize.x : 0;
+    if ((tile < 0) || (columns == 0))
+    {
+        for (int i = 0; i < 4; ++i)
+            quad[i] = Vertex(iVector2f(left, top), iColor::Transparent);
+        return;
+    }
+
+    // Find the position of the tile in the tileset texture
+    float tu = static_cast<float>((tile % columns) * m_tileSize.x);
+    float tv = static_cast<float>((tile / columns) * m_tileSize.y);
+
+    quad[0] = Vertex(iVector2f(left, top),     iVector2f(tu, tv));
+    quad[1] = Vertex(iVector2f(right, top),    iVector2f(tu + m_tileSize.x, tv));
+    quad[2] = Vertex(iVector2f(right, bottom), iVector2f(tu + m_tileSize.x, tv + m_tileSize.y));
+    quad[3] = Vertex(iVector2f(left, bottom),  iVector2f(tu, tv + m_tileSize.y));
+}
+
+} // namespace sf
@@ -26,66 +26,117 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Transform.hpp"
-#include <cmath>
+#include "SinCos.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_TRANSFORM_SSE2
+#endif
 
-namespace sf
-{
-////////////////////////////////////////////////////////////
-const Transform Transform::Identity;
 
-
-////////////////////////////////////////////////////////////
-Transform::Transform()
+namespace
 {
-    // Identity matrix
-    m_matrix[0] = 1.f; m_matrix[4] = 0.f; m_matrix[8]  = 0.f; m_matrix[12] = 0.f;
-    m_matrix[1] = 0.f; m_matrix[5] = 1.f; m_matrix[9]  = 0.f; m_matrix[13] = 0.f;
-    m_matrix[2] = 0.f; m_matrix[6] = 0.f; m_matrix[10] = 1.f; m_matrix[14] = 0.f;
-    m_matrix[3] = 0.f; m_matrix[7] = 0.f; m_matrix[11] = 0.f; m_matrix[15] = 1.f;
+    ////////////////////////////////////////////////////////////
+    // Bounding rectangle of a rectangle transformed by the
+    // 2x3 matrix m, stored by columns
+    ////////////////////////////////////////////////////////////
+    sf::FloatRect transformRectangle(const float* m, const sf::FloatRect& rectangle)
+    {
+        const float left   = rectangle.left;
+        const float top    = rectangle.top;
+        const float right  = rectangle.left + rectangle.width;
+        const float bottom = rectangle.top + rectangle.height;
+
+#ifdef SFML_TRANSFORM_SSE2
+        // Transform the 4 corners at once, then reduce them to their extents
+        const __m128 x  = _mm_setr_ps(left, left, right, right);
+        const __m128 y  = _mm_setr_ps(top, bottom, top, bottom);
+        const __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[2]), y)), _mm_set1_ps(m[4]));
+        const __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[1]), x), _mm_mul_ps(_mm_set1_ps(m[3]), y)), _mm_set1_ps(m[5]));
+
+        // Interleave the corners as (x, y, x, y): even lanes hold x and odd
+        // lanes y, low keeping the minima and high the maxima of two corners
+        __m128 low  = _mm_min_ps(_mm_unpacklo_ps(tx, ty), _mm_unpackhi_ps(tx, ty));
+        __m128 high = _mm_max_ps(_mm_unpacklo_ps(tx, ty), _mm_unpackhi_ps(tx, ty));
+
+        // Fold the upper pair onto the lower one, leaving (minX, minY) in
+        // the low lanes of low and (maxX, maxY) in those of high
+        low  = _mm_min_ps(low,  _mm_movehl_ps(low,  low));
+        high = _mm_max_ps(high, _mm_movehl_ps(high, high));
+
+        // extents = {minX, minY, maxX, maxY}
+        float extents[4];
+        _mm_storel_pi(reinterpret_cast<__m64*>(&extents[0]), low);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&extents[2]), high);
+
+        return sf::FloatRect(extents[0], extents[1], extents[2] - extents[0], extents[3] - extents[1]);
+#else
+        // Transform the 4 corners of the rectangle
+        const float xs[] = {left, left, right, right};
+        const float ys[] = {top, bottom, top, bottom};
+
+        // Compute the bounding rectangle of the transformed points
+        float minX = m[0] * xs[0] + m[2] * ys[0] + m[4];
+        float minY = m[1] * xs[0] + m[3] * ys[0] + m[5];
+        float maxX = minX;
+        float maxY = minY;
+        for (int i = 1; i < 4; ++i)
+        {
+            const float x = m[0] * xs[i] + m[2] * ys[i] + m[4];
+            const float y = m[1] * xs[i] + m[3] * ys[i] + m[5];
+            if      (x < minX) minX = x;
+            else if (x > maxX) maxX = x;
+            if      (y < minY) minY = y;
+            else if (y > maxY) maxY = y;
+        }
+
+        return sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+#endif
+    }
 }
 
 
-////////////////////////////////////////////////////////////
-Transform::Transform(float a00, float a01, float a02,
-                     float a10, float a11, float a12,
-                     float a20, float a21, float a22)
+namespace sf
 {
-    m_matrix[0] = a00; m_matrix[4] = a01; m_matrix[8]  = 0.f; m_matrix[12] = a02;
-    m_matrix[1] = a10; m_matrix[5] = a11; m_matrix[9]  = 0.f; m_matrix[13] = a12;
-    m_matrix[2] = 0.f; m_matrix[6] = 0.f; m_matrix[10] = 1.f; m_matrix[14] = 0.f;
-    m_matrix[3] = a20; m_matrix[7] = a21; m_matrix[11] = 0.f; m_matrix[15] = a22;
-}
-
-
 ////////////////////////////////////////////////////////////
-const float* Transform::getMatrix() const
+void Transform::getMatrix(float* matrix) const
 {
-    return m_matrix;
+    matrix[0] = m_matrix[0]; matrix[4] = m_matrix[2]; matrix[8]  = 0.f; matrix[12] = m_matrix[4];
+    matrix[1] = m_matrix[1]; matrix[5] = m_matrix[3]; matrix[9]  = 0.f; matrix[13] = m_matrix[5];
+    matrix[2] = 0.f;         matrix[6] = 0.f;         matrix[10] = 1.f; matrix[14] = 0.f;
+    matrix[3] = 0.f;         matrix[7] = 0.f;         matrix[11] = 0.f; matrix[15] = 1.f;
 }
 
 
 ////////////////////////////////////////////////////////////
 Transform Transform::getInverse() const
 {
+    const float* m = m_matrix;
+
     // Compute the determinant
-    float det = m_matrix[0] * (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) -
-                m_matrix[1] * (m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) +
-                m_matrix[3] * (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]);
+    float det = m[0] * m[3] - m[1] * m[2];
 
     // Compute the inverse if the determinant is not zero
     // (don't use an epsilon because the determinant may *really* be tiny)
     if (det != 0.f)
     {
-        return Transform( (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) / det,
-                         -(m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) / det,
-                          (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]) / det,
-                         -(m_matrix[15] * m_matrix[1] - m_matrix[3] * m_matrix[13]) / det,
-                          (m_matrix[15] * m_matrix[0] - m_matrix[3] * m_matrix[12]) / det,
-                         -(m_matrix[13] * m_matrix[0] - m_matrix[1] * m_matrix[12]) / det,
-                          (m_matrix[7]  * m_matrix[1] - m_matrix[3] * m_matrix[5])  / det,
-                         -(m_matrix[7]  * m_matrix[0] - m_matrix[3] * m_matrix[4])  / det,
-                          (m_matrix[5]  * m_matrix[0] - m_matrix[1] * m_matrix[4])  / det);
+        Transform inverse;
+        float* r = inverse.m_matrix;
+
+#ifdef SFML_TRANSFORM_SSE2
+        // Linear part: (a11, -a10, -a01, a00) / det
+        const __m128 linear = _mm_setr_ps(m[3], -m[1], -m[2], m[0]);
+        _mm_storeu_ps(r, _mm_div_ps(linear, _mm_set1_ps(det)));
+#else
+        r[0] =  m[3] / det;
+        r[1] = -m[1] / det;
+        r[2] = -m[2] / det;
+        r[3] =  m[0] / det;
+#endif
+        r[4] =  (m[5] * m[2] - m[3] * m[4]) / det;
+        r[5] = -(m[5] * m[0] - m[1] * m[4]) / det;
+
+        return inverse;
     }
     else
     {
@@ -95,46 +146,42 @@ Transform Transform::getInverse() const
 
 
 ////////////////////////////////////////////////////////////
-iVector2f Transform::transformPoint(float x, float y) const
+FloatRect Transform::transformRect(const FloatRect& rectangle) const
 {
-    return iVector2f(m_matrix[0] * x + m_matrix[4] * y + m_matrix[12],
-                    m_matrix[1] * x + m_matrix[5] * y + m_matrix[13]);
+    return transformRectangle(m_matrix, rectangle);
 }
 
 
 ////////////////////////////////////////////////////////////
-iVector2f Transform::transformPoint(const iVector2f& point) const
+void Transform::transformPoints(const iVector2f* points, iVector2f* result, std::size_t count) const
 {
-    return transformPoint(point.x, point.y);
-}
+    std::size_t i = 0;
 
+#ifdef SFML_TRANSFORM_SSE2
+    // Transform two points per register: (x0, y0, x1, y1)
+    const __m128 columnX     = _mm_setr_ps(m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]);
+    const __m128 columnY     = _mm_setr_ps(m_matrix[2], m_matrix[3], m_matrix[2], m_matrix[3]);
+    const __m128 translation = _mm_setr_ps(m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]);
 
-////////////////////////////////////////////////////////////
-FloatRect Transform::transformRect(const FloatRect& rectangle) const
-{
-    // Transform the 4 corners of the rectangle
-    const iVector2f points[] =
+    for (; i + 2 <= count; i += 2)
     {
-        transformPoint(rectangle.left, rectangle.top),
-        transformPoint(rectangle.left, rectangle.top + rectangle.height),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top + rectangle.height)
-    };
-
-    // Compute the bounding rectangle of the transformed points
-    float left = points[0].x;
-    float top = points[0].y;
-    float right = points[0].x;
-    float bottom = points[0].y;
-    for (int i = 1; i < 4; ++i)
-    {
-        if      (points[i].x < left)   left = points[i].x;
-        else if (points[i].x > right)  right = points[i].x;
-        if      (points[i].y < top)    top = points[i].y;
-        else if (points[i].y > bottom) bottom = points[i].y;
+        const __m128 p = _mm_loadu_ps(&points[i].x);
+        const __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(&result[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, columnX), _mm_mul_ps(y, columnY)), translation));
     }
+#endif
+
+    for (; i < count; ++i)
+        result[i] = transformPoint(points[i].x, points[i].y);
+}
+
 
-    return FloatRect(left, top, right - left, bottom - top);
+////////////////////////////////////////////////////////////
+void Transform::transformRects(const FloatRect* rectangles, FloatRect* result, std::size_t count) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = transformRectangle(m_matrix, rectangles[i]);
 }
 
 
@@ -144,15 +191,30 @@ Transform& Transform::combine(const Transform& transform)
     const float* a = m_matrix;
     const float* b = transform.m_matrix;
 
-    *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
-                      a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
-                      a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
-                      a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
-                      a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
-                      a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
-                      a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
-                      a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
-                      a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+    // Translation first, as it reads the linear part of a before it is overwritten
+    const float x = a[0] * b[4] + a[2] * b[5] + a[4];
+    const float y = a[1] * b[4] + a[3] * b[5] + a[5];
+
+#ifdef SFML_TRANSFORM_SSE2
+    // Linear part: each column of the result is a combination of the columns of a
+    const __m128 la = _mm_loadu_ps(a);
+    const __m128 lb = _mm_loadu_ps(b);
+    const __m128 columnX = _mm_shuffle_ps(la, la, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m128 columnY = _mm_shuffle_ps(la, la, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m128 factorX = _mm_shuffle_ps(lb, lb, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128 factorY = _mm_shuffle_ps(lb, lb, _MM_SHUFFLE(3, 3, 1, 1));
+    _mm_storeu_ps(m_matrix, _mm_add_ps(_mm_mul_ps(columnX, factorX), _mm_mul_ps(columnY, factorY)));
+#else
+    const float a00 = a[0] * b[0] + a[2] * b[1];
+    const float a10 = a[1] * b[0] + a[3] * b[1];
+    const float a01 = a[0] * b[2] + a[2] * b[3];
+    const float a11 = a[1] * b[2] + a[3] * b[3];
+    m_matrix[0] = a00; m_matrix[2] = a01;
+    m_matrix[1] = a10; m_matrix[3] = a11;
+#endif
+
+    m_matrix[4] = x;
+    m_matrix[5] = y;
 
     return *this;
 }
@@ -179,9 +241,9 @@ Transform& Transform::translate(const iVector2f& offset)
 ////////////////////////////////////////////////////////////
 Transform& Transform::rotate(float angle)
 {
-    float rad = angle * 3.141592654f / 180.f;
-    float cos = std::cos(rad);
-    float sin = std::sin(rad);
+    float sin;
+    float cos;
+    priv::sinCosDegrees(angle, sin, cos);
 
     Transform rotation(cos, -sin, 0,
                        sin,  cos, 0,
@@ -194,9 +256,9 @@ Transform& Transform::rotate(float angle)
 ////////////////////////////////////////////////////////////
 Transform& Transform::rotate(float angle, float centerX, float centerY)
 {
-    float rad = angle * 3.141592654f / 180.f;
-    float cos = std::cos(rad);
-    float sin = std::sin(rad);
+    float sin;
+    float cos;
+    priv::sinCosDegrees(angle, sin, cos);
 
     Transform rotation(cos, -sin, centerX * (1 - cos) + centerY * sin,
                        sin,  cos, centerY * (1 - cos) - centerX * sin,
@@ -262,30 +324,4 @@ Transform& operator *=(Transform& left, const Transform& right)
     return left.combine(right);
 }
 
-
-////////////////////////////////////////////////////////////
-iVector2f operator *(const Transform& left, const iVector2f& right)
-{
-    return left.transformPoint(right);
-}
-
-
-////////////////////////////////////////////////////////////
-bool operator ==(const Transform& left, const Transform& right)
-{
-    const float* a = left.getMatrix();
-    const float* b = right.getMatrix();
-
-    return ((a[0]  == b[0])  && (a[1]  == b[1])  && (a[3]  == b[3]) &&
-            (a[4]  == b[4])  && (a[5]  == b[5])  && (a[7]  == b[7]) &&
-            (a[12] == b[12]) && (a[13] == b[13]) && (a[15] == b[15]));
-}
-
-
-////////////////////////////////////////////////////////////
-bool operator !=(const Transform& left, const Transform& right)
-{
-    return !(left == right);
-}
-
 } // namespace sf
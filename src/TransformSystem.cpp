@@ -0,0 +1,391 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "TransformSystem.hpp"
+#include "ThreadPool.hpp"
+#include "Profiler.hpp"
+#include "SinCos.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_TRANSFORMSYSTEM_SSE2
+#endif
+
+
+namespace
+{
+    // Number of objects updated by one task
+    const std::size_t chunkSize = 16384;
+
+    // Computes the matrix of an object, exactly as sf::Transformable does
+    inline sf::Transform computeTransform(float x, float y, float rotation, float scaleX, float scaleY,
+                                          float originX, float originY)
+    {
+        float sine;
+        float cosine;
+        sf::priv::sinCosDegrees(-rotation, sine, cosine);
+        float sxc    = scaleX * cosine;
+        float syc    = scaleY * cosine;
+        float sxs    = scaleX * sine;
+        float sys    = scaleY * sine;
+        float tx     = -originX * sxc - originY * sys + x;
+        float ty     =  originX * sxs - originY * syc + y;
+
+        return sf::Transform( sxc, sys, tx,
+                             -sxs, syc, ty,
+                              0.f, 0.f, 1.f);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TransformSystem::TransformSystem(unsigned int threadCount) :
+m_positionsX (),
+m_positionsY (),
+m_rotations  (),
+m_scalesX    (),
+m_scalesY    (),
+m_originsX   (),
+m_originsY   (),
+m_dirty      (),
+m_transforms (),
+m_handles    (),
+m_indices    (),
+m_freeHandles(),
+m_needUpdate (false),
+m_threadPool ((threadCount > 0) ? new priv::ThreadPool(threadCount) : &priv::ThreadPool::getShared())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TransformSystem::~TransformSystem()
+{
+    if (!m_threadPool->isShared())
+        delete m_threadPool;
+}
+
+
+////////////////////////////////////////////////////////////
+int TransformSystem::create()
+{
+    int handle;
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+    else
+    {
+        handle = static_cast<int>(m_indices.size());
+        m_indices.push_back(-1);
+    }
+
+    m_indices[handle] = static_cast<int>(m_handles.size());
+    m_handles.push_back(handle);
+
+    m_positionsX.push_back(0.f);
+    m_positionsY.push_back(0.f);
+    m_rotations.push_back(0.f);
+    m_scalesX.push_back(1.f);
+    m_scalesY.push_back(1.f);
+    m_originsX.push_back(0.f);
+    m_originsY.push_back(0.f);
+    m_dirty.push_back(0);
+    m_transforms.push_back(Transform::Identity);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::destroy(int handle)
+{
+    // Move the last object in place of the destroyed one, to keep the arrays packed
+    std::size_t index = static_cast<std::size_t>(m_indices[handle]);
+    std::size_t last  = m_handles.size() - 1;
+
+    if (index != last)
+    {
+        m_positionsX[index] = m_positionsX[last];
+        m_positionsY[index] = m_positionsY[last];
+        m_rotations[index]  = m_rotations[last];
+        m_scalesX[index]    = m_scalesX[last];
+        m_scalesY[index]    = m_scalesY[last];
+        m_originsX[index]   = m_originsX[last];
+        m_originsY[index]   = m_originsY[last];
+        m_dirty[index]      = m_dirty[last];
+        m_transforms[index] = m_transforms[last];
+        m_handles[index]    = m_handles[last];
+        m_indices[m_handles[index]] = static_cast<int>(index);
+    }
+
+    m_positionsX.pop_back();
+    m_positionsY.pop_back();
+    m_rotations.pop_back();
+    m_scalesX.pop_back();
+    m_scalesY.pop_back();
+    m_originsX.pop_back();
+    m_originsY.pop_back();
+    m_dirty.pop_back();
+    m_transforms.pop_back();
+    m_handles.pop_back();
+
+    m_indices[handle] = -1;
+    m_freeHandles.push_back(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::clear()
+{
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_rotations.clear();
+    m_scalesX.clear();
+    m_scalesY.clear();
+    m_originsX.clear();
+    m_originsY.clear();
+    m_dirty.clear();
+    m_transforms.clear();
+    m_handles.clear();
+    m_indices.clear();
+    m_freeHandles.clear();
+    m_needUpdate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformSystem::getCount() const
+{
+    return m_handles.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::setPosition(int handle, const iVector2f& position)
+{
+    int index = m_indices[handle];
+    m_positionsX[index] = position.x;
+    m_positionsY[index] = position.y;
+    m_dirty[index] = 1;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::setRotation(int handle, float angle)
+{
+    float rotation = static_cast<float>(fmod(angle, 360));
+    if (rotation < 0)
+        rotation += 360.f;
+
+    int index = m_indices[handle];
+    m_rotations[index] = rotation;
+    m_dirty[index] = 1;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::setScale(int handle, const iVector2f& factors)
+{
+    int index = m_indices[handle];
+    m_scalesX[index] = factors.x;
+    m_scalesY[index] = factors.y;
+    m_dirty[index] = 1;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::setOrigin(int handle, const iVector2f& origin)
+{
+    int index = m_indices[handle];
+    m_originsX[index] = origin.x;
+    m_originsY[index] = origin.y;
+    m_dirty[index] = 1;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f TransformSystem::getPosition(int handle) const
+{
+    int index = m_indices[handle];
+    return iVector2f(m_positionsX[index], m_positionsY[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+float TransformSystem::getRotation(int handle) const
+{
+    return m_rotations[m_indices[handle]];
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f TransformSystem::getScale(int handle) const
+{
+    int index = m_indices[handle];
+    return iVector2f(m_scalesX[index], m_scalesY[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+iVector2f TransformSystem::getOrigin(int handle) const
+{
+    int index = m_indices[handle];
+    return iVector2f(m_originsX[index], m_originsY[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::update()
+{
+    if (!m_needUpdate)
+        return;
+
+    SFML_PROFILE_SCOPE("TransformSystem::update");
+
+    std::size_t chunkCount = (m_handles.size() + chunkSize - 1) / chunkSize;
+    m_threadPool->run(chunkCount, [this](std::size_t chunk) { updateChunk(chunk); });
+
+    m_needUpdate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& TransformSystem::getTransform(int handle) const
+{
+    return m_transforms[m_indices[handle]];
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform* TransformSystem::getTransforms() const
+{
+    return m_transforms.empty() ? NULL : &m_transforms[0];
+}
+
+
+////////////////////////////////////////////////////////////
+const int* TransformSystem::getHandles() const
+{
+    return m_handles.empty() ? NULL : &m_handles[0];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TransformSystem::getIndex(int handle) const
+{
+    return static_cast<std::size_t>(m_indices[handle]);
+}
+
+
+////////////////////////////////////////////////////////////
+void TransformSystem::updateChunk(std::size_t chunk)
+{
+    std::size_t begin = chunk * chunkSize;
+    std::size_t end   = std::min(begin + chunkSize, m_handles.size());
+
+    const float* x  = &m_positionsX[0];
+    const float* y  = &m_positionsY[0];
+    const float* r  = &m_rotations[0];
+    const float* sx = &m_scalesX[0];
+    const float* sy = &m_scalesY[0];
+    const float* ox = &m_originsX[0];
+    const float* oy = &m_originsY[0];
+    Uint8*   dirty  = &m_dirty[0];
+
+    std::size_t i = begin;
+
+#ifdef SFML_TRANSFORMSYSTEM_SSE2
+    // Combine the components of four objects at once; groups
+    // where no object moved are skipped with a single test
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    for (; i + 4 <= end; i += 4)
+    {
+        Uint32 flags;
+        std::memcpy(&flags, dirty + i, sizeof(flags));
+        if (flags == 0)
+            continue;
+
+        float angles[4] = {-r[i], -r[i + 1], -r[i + 2], -r[i + 3]};
+        float sines[4];
+        float cosines[4];
+        priv::sinCosDegrees(angles, sines, cosines, 4);
+
+        __m128 cosine  = _mm_loadu_ps(cosines);
+        __m128 sine    = _mm_loadu_ps(sines);
+        __m128 scaleX  = _mm_loadu_ps(sx + i);
+        __m128 scaleY  = _mm_loadu_ps(sy + i);
+        __m128 originX = _mm_loadu_ps(ox + i);
+        __m128 originY = _mm_loadu_ps(oy + i);
+        __m128 sxc     = _mm_mul_ps(scaleX, cosine);
+        __m128 syc     = _mm_mul_ps(scaleY, cosine);
+        __m128 sxs     = _mm_mul_ps(scaleX, sine);
+        __m128 sys     = _mm_mul_ps(scaleY, sine);
+        __m128 tx      = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_xor_ps(originX, signMask), sxc), _mm_mul_ps(originY, sys)), _mm_loadu_ps(x + i));
+        __m128 ty      = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(originX, sxs), _mm_mul_ps(originY, syc)), _mm_loadu_ps(y + i));
+
+        float elements[6][4];
+        _mm_storeu_ps(elements[0], sxc);
+        _mm_storeu_ps(elements[1], sys);
+        _mm_storeu_ps(elements[2], tx);
+        _mm_storeu_ps(elements[3], _mm_xor_ps(sxs, signMask));
+        _mm_storeu_ps(elements[4], syc);
+        _mm_storeu_ps(elements[5], ty);
+
+        for (int k = 0; k < 4; ++k)
+        {
+            m_transforms[i + k] = Transform(elements[0][k], elements[1][k], elements[2][k],
+                                            elements[3][k], elements[4][k], elements[5][k],
+                                            0.f,            0.f,            1.f);
+        }
+
+        std::memset(dirty + i, 0, 4);
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        if (dirty[i])
+        {
+            m_transforms[i] = computeTransform(x[i], y[i], r[i], sx[i], sy[i], ox[i], oy[i]);
+            dirty[i] = 0;
+        }
+    }
+}
+
+} // namespace sf
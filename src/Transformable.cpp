@@ -26,6 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "Transformable.hpp"
+#include "Profiler.hpp"
+#include "SinCos.hpp"
 #include <cmath>
 
 
@@ -33,14 +35,15 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Transformable::Transformable() :
-m_origin                    (0, 0),
-m_position                  (0, 0),
-m_rotation                  (0),
-m_scale                     (1, 1),
-m_transform                 (),
-m_transformNeedUpdate       (true),
-m_inverseTransform          (),
-m_inverseTransformNeedUpdate(true)
+m_origin               (0, 0),
+m_position             (0, 0),
+m_rotation             (0),
+m_scale                (1, 1),
+m_transform            (),
+m_transformState       (),
+m_inverseTransform     (),
+m_inverseTransformState(),
+m_transformRevision    (0)
 {
 }
 
@@ -56,8 +59,9 @@ void Transformable::setPosition(float x, float y)
 {
     m_position.x = x;
     m_position.y = y;
-    m_transformNeedUpdate = true;
-    m_inverseTransformNeedUpdate = true;
+    m_transformState.invalidate();
+    m_inverseTransformState.invalidate();
+    ++m_transformRevision;
 }
 
 
@@ -75,8 +79,9 @@ void Transformable::setRotation(float angle)
     if (m_rotation < 0)
         m_rotation += 360.f;
 
-    m_transformNeedUpdate = true;
-    m_inverseTransformNeedUpdate = true;
+    m_transformState.invalidate();
+    m_inverseTransformState.invalidate();
+    ++m_transformRevision;
 }
 
 
@@ -85,8 +90,9 @@ void Transformable::setScale(float factorX, float factorY)
 {
     m_scale.x = factorX;
     m_scale.y = factorY;
-    m_transformNeedUpdate = true;
-    m_inverseTransformNeedUpdate = true;
+    m_transformState.invalidate();
+    m_inverseTransformState.invalidate();
+    ++m_transformRevision;
 }
 
 
@@ -102,8 +108,9 @@ void Transformable::setOrigin(float x, float y)
 {
     m_origin.x = x;
     m_origin.y = y;
-    m_transformNeedUpdate = true;
-    m_inverseTransformNeedUpdate = true;
+    m_transformState.invalidate();
+    m_inverseTransformState.invalidate();
+    ++m_transformRevision;
 }
 
 
@@ -180,12 +187,15 @@ void Transformable::scale(const iVector2f& factor)
 ////////////////////////////////////////////////////////////
 const Transform& Transformable::getTransform() const
 {
-    // Recompute the combined transform if needed
-    if (m_transformNeedUpdate)
+    // Recompute the combined transform if needed; concurrent
+    // callers wait for the first one to publish it
+    if (!m_transformState.isValid() && m_transformState.beginUpdate())
     {
-        float angle  = -m_rotation * 3.141592654f / 180.f;
-        float cosine = static_cast<float>(std::cos(angle));
-        float sine   = static_cast<float>(std::sin(angle));
+        SFML_PROFILE_SCOPE("Transformable::getTransform");
+
+        float sine;
+        float cosine;
+        priv::sinCosDegrees(-m_rotation, sine, cosine);
         float sxc    = m_scale.x * cosine;
         float syc    = m_scale.y * cosine;
         float sxs    = m_scale.x * sine;
@@ -196,7 +206,7 @@ const Transform& Transformable::getTransform() const
         m_transform = Transform( sxc, sys, tx,
                                 -sxs, syc, ty,
                                  0.f, 0.f, 1.f);
-        m_transformNeedUpdate = false;
+        m_transformState.endUpdate();
     }
 
     return m_transform;
@@ -207,13 +217,20 @@ const Transform& Transformable::getTransform() const
 const Transform& Transformable::getInverseTransform() const
 {
     // Recompute the inverse transform if needed
-    if (m_inverseTransformNeedUpdate)
+    if (!m_inverseTransformState.isValid() && m_inverseTransformState.beginUpdate())
     {
         m_inverseTransform = getTransform().getInverse();
-        m_inverseTransformNeedUpdate = false;
+        m_inverseTransformState.endUpdate();
     }
 
     return m_inverseTransform;
 }
 
+
+////////////////////////////////////////////////////////////
+Uint32 Transformable::getTransformRevision() const
+{
+    return m_transformRevision;
+}
+
 } // namespace sf
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "UnitCircle.hpp"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <vector>
+
+
+namespace
+{
+    // Tables of the point counts requested so far; the nodes of a map
+    // never move, so the tables stay where they are once inserted
+    std::map<std::size_t, std::vector<sf::iVector2f> >& getTables()
+    {
+        static std::map<std::size_t, std::vector<sf::iVector2f> > tables;
+        return tables;
+    }
+
+    std::mutex& getMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+const iVector2f* getUnitCircle(std::size_t pointCount)
+{
+    if (pointCount == 0)
+        return NULL;
+
+    std::lock_guard<std::mutex> lock(getMutex());
+
+    std::vector<iVector2f>& table = getTables()[pointCount];
+    if (table.empty())
+    {
+        static const float pi = 3.141592654f;
+
+        table.resize(pointCount);
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            float angle = i * 2 * pi / pointCount - pi / 2;
+            table[i] = iVector2f(std::cos(angle), std::sin(angle));
+        }
+    }
+
+    return &table[0];
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_UNITCIRCLE_HPP
+#define SFML_UNITCIRCLE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Vector2.hpp"
+#include <cstddef>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Get the points of a circle of radius 1 centered on the origin
+///
+/// The first point is at the top of the circle, and the next
+/// ones go clockwise (in a y-down coordinate system) with
+/// evenly spaced angles. The table of each point count is
+/// computed on the first request, then shared by every caller;
+/// it is never modified nor freed, so the returned pointer can
+/// be kept. This function can be called from several threads.
+///
+/// \param pointCount Number of points of the circle
+///
+/// \return Pointer to the \a pointCount points, NULL if \a pointCount is 0
+///
+////////////////////////////////////////////////////////////
+const iVector2f* getUnitCircle(std::size_t pointCount);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_UNITCIRCLE_HPP
@@ -26,15 +26,141 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "VertexArray.hpp"
-#include <raylib.h>
-#include <rlgl.h>
+#include "RenderTarget.hpp"
+#include "ThreadPool.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define SFML_VERTEXARRAY_SSE2
+#endif
+
+
+namespace
+{
+    // Arrays with at least this many vertices have their bounds reduced in parallel
+    const std::size_t parallelThreshold = 262144;
+
+    // Number of vertices reduced by one task
+    const std::size_t chunkSize = 65536;
+
+    // Computes the extents (left, top, right, bottom) of a non-empty range of vertices
+    void computeExtents(const sf::Vertex* vertices, std::size_t count, float* extents)
+    {
+        float left   = vertices[0].position.x;
+        float top    = vertices[0].position.y;
+        float right  = vertices[0].position.x;
+        float bottom = vertices[0].position.y;
+        std::size_t i = 1;
+
+#ifdef SFML_VERTEXARRAY_SSE2
+        if (count >= 5)
+        {
+            // Two positions per register, as (x, y, x, y), with two pairs of
+            // accumulators to hide the latency of min and max
+            __m128 first = _mm_setr_ps(left, top, left, top);
+            __m128 min0  = first;
+            __m128 max0  = first;
+            __m128 min1  = first;
+            __m128 max1  = first;
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 p0 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vertices[i].position));
+                __m128 p1 = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vertices[i + 2].position));
+                p0 = _mm_loadh_pi(p0, reinterpret_cast<const __m64*>(&vertices[i + 1].position));
+                p1 = _mm_loadh_pi(p1, reinterpret_cast<const __m64*>(&vertices[i + 3].position));
+                min0 = _mm_min_ps(min0, p0);
+                max0 = _mm_max_ps(max0, p0);
+                min1 = _mm_min_ps(min1, p1);
+                max1 = _mm_max_ps(max1, p1);
+            }
+
+            min0 = _mm_min_ps(min0, min1);
+            max0 = _mm_max_ps(max0, max1);
+            min0 = _mm_min_ps(min0, _mm_movehl_ps(min0, min0));
+            max0 = _mm_max_ps(max0, _mm_movehl_ps(max0, max0));
+
+            float low[4];
+            float high[4];
+            _mm_storeu_ps(low, min0);
+            _mm_storeu_ps(high, max0);
+            left   = low[0];
+            top    = low[1];
+            right  = high[0];
+            bottom = high[1];
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const sf::iVector2f& position = vertices[i].position;
+            left   = std::min(left, position.x);
+            top    = std::min(top, position.y);
+            right  = std::max(right, position.x);
+            bottom = std::max(bottom, position.y);
+        }
+
+        extents[0] = left;
+        extents[1] = top;
+        extents[2] = right;
+        extents[3] = bottom;
+    }
+
+    // Computes the bounds of the vertices, in parallel for large arrays
+    sf::FloatRect computeBounds(const std::vector<sf::Vertex>& vertices)
+    {
+        SFML_PROFILE_SCOPE("VertexArray::getBounds");
+
+        if (vertices.empty())
+            return sf::FloatRect();
+
+        float extents[4];
+
+        if (vertices.size() >= parallelThreshold)
+        {
+            // The pool runs the chunks on the calling thread alone if it is busy
+            std::size_t chunks = (vertices.size() + chunkSize - 1) / chunkSize;
+            std::vector<float> partials(chunks * 4);
+
+            sf::priv::ThreadPool::getShared().run(chunks, [&vertices, &partials](std::size_t chunk)
+            {
+                std::size_t begin = chunk * chunkSize;
+                std::size_t count = std::min(chunkSize, vertices.size() - begin);
+                computeExtents(&vertices[begin], count, &partials[chunk * 4]);
+            });
+
+            extents[0] = partials[0];
+            extents[1] = partials[1];
+            extents[2] = partials[2];
+            extents[3] = partials[3];
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+            {
+                extents[0] = std::min(extents[0], partials[chunk * 4 + 0]);
+                extents[1] = std::min(extents[1], partials[chunk * 4 + 1]);
+                extents[2] = std::max(extents[2], partials[chunk * 4 + 2]);
+                extents[3] = std::max(extents[3], partials[chunk * 4 + 3]);
+            }
+        }
+        else
+        {
+            computeExtents(&vertices[0], vertices.size(), extents);
+        }
+
+        return sf::FloatRect(extents[0], extents[1], extents[2] - extents[0], extents[3] - extents[1]);
+    }
+}
+
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 VertexArray::VertexArray() :
 m_vertices     (),
-m_primitiveType(Points)
+m_primitiveType(Points),
+m_bounds       (),
+m_boundsState  ()
 {
 }
 
@@ -42,7 +168,9 @@ m_primitiveType(Points)
 ////////////////////////////////////////////////////////////
 VertexArray::VertexArray(PrimitiveType type, std::size_t vertexCount) :
 m_vertices     (vertexCount),
-m_primitiveType(type)
+m_primitiveType(type),
+m_bounds       (),
+m_boundsState  ()
 {
 }
 
@@ -57,6 +185,7 @@ std::size_t VertexArray::getVertexCount() const
 ////////////////////////////////////////////////////////////
 Vertex& VertexArray::operator [](std::size_t index)
 {
+    m_boundsState.invalidate();
     return m_vertices[index];
 }
 
@@ -72,6 +201,7 @@ const Vertex& VertexArray::operator [](std::size_t index) const
 void VertexArray::clear()
 {
     m_vertices.clear();
+    m_boundsState.invalidate();
 }
 
 
@@ -79,6 +209,7 @@ void VertexArray::clear()
 void VertexArray::resize(std::size_t vertexCount)
 {
     m_vertices.resize(vertexCount);
+    m_boundsState.invalidate();
 }
 
 
@@ -86,6 +217,7 @@ void VertexArray::resize(std::size_t vertexCount)
 void VertexArray::append(const Vertex& vertex)
 {
     m_vertices.push_back(vertex);
+    m_boundsState.invalidate();
 }
 
 
@@ -106,187 +238,23 @@ PrimitiveType VertexArray::getPrimitiveType() const
 ////////////////////////////////////////////////////////////
 FloatRect VertexArray::getBounds() const
 {
-    if (!m_vertices.empty())
+    if (!m_boundsState.isValid() && m_boundsState.beginUpdate())
     {
-        float left   = m_vertices[0].position.x;
-        float top    = m_vertices[0].position.y;
-        float right  = m_vertices[0].position.x;
-        float bottom = m_vertices[0].position.y;
-
-        for (std::size_t i = 1; i < m_vertices.size(); ++i)
-        {
-            iVector2f position = m_vertices[i].position;
-
-            // Update left and right
-            if (position.x < left)
-                left = position.x;
-            else if (position.x > right)
-                right = position.x;
-
-            // Update top and bottom
-            if (position.y < top)
-                top = position.y;
-            else if (position.y > bottom)
-                bottom = position.y;
-        }
-
-        return FloatRect(left, top, right - left, bottom - top);
-    }
-    else
-    {
-        // Array is empty
-        return FloatRect();
+        m_bounds = computeBounds(m_vertices);
+        m_boundsState.endUpdate();
     }
+
+    return m_bounds;
 }
 
 
 ////////////////////////////////////////////////////////////
-void VertexArray::draw() const
+void VertexArray::draw(RenderTarget& target, RenderStates states) const
 {
-    if (m_vertices.empty())
+    if (m_vertices.empty() || target.cull(states.transform.transformRect(getBounds())))
         return;
 
-     int pointCount = (int) m_vertices.size();
-
-
-    rlPushMatrix();
-           if (getPrimitiveType()== PrimitiveType::Points)
-            {
-                rlBegin(RL_LINES);
-                for (int i = 0; i < pointCount ; i++)
-                {
-
-
-
-                     iColor c =m_vertices[i ].color;
-                     Vector2 v0=(Vector2){m_vertices[i].position.x,m_vertices[i].position.y};
-                     Vector2 vt0=(Vector2){m_vertices[i].texCoords.x,m_vertices[i].texCoords.y};
-
-                    rlColor4ub(c.r,c.g,c.b,c.a);
-                    rlTexCoord2f(vt0.x,vt0.y);
-                    rlVertex2f(v0.x, v0.y);
-                    rlColor4ub(c.r,c.g,c.b,c.a);
-                    rlTexCoord2f(vt0.x,vt0.y);
-                    rlVertex2f(v0.x+1, v0.y+1);
-
-
-                //    DrawPixel(m_vertices[i].position.x,m_vertices[i].position.y,(Color){c.r,c.g,c.b,c.a});
-
-                }
-            rlEnd();
-
-            } else
-            if (getPrimitiveType()== PrimitiveType::Quads)
-            {
-
-
-
-              int pointCount = (int) m_vertices.size();
-
-        rlCheckRenderBatchLimit((pointCount - 2)*4);
-
-
-
-            rlBegin(RL_QUADS);
-
-
-
-
-            for (int i = 1; i < pointCount - 1; i++)
-            {
-
-
-                 iColor c2 =m_vertices[0].color;
-                 iColor c1 =m_vertices[i].color;
-                 iColor c0 =m_vertices[i+1].color;
-
-
-
-                Vector2 v2=(Vector2){m_vertices[0].position.x,m_vertices[0].position.y};
-                Vector2 v1=(Vector2){m_vertices[i].position.x,m_vertices[i].position.y};
-                Vector2 v0=(Vector2){m_vertices[i+1].position.x,m_vertices[i+1].position.y};
-
-                Vector2 vt2=(Vector2){m_vertices[0].texCoords.x,m_vertices[0].texCoords.y};
-                Vector2 vt1=(Vector2){m_vertices[i].texCoords.x,m_vertices[i].texCoords.y};
-                Vector2 vt0=(Vector2){m_vertices[i+1].texCoords.x,m_vertices[i+1].texCoords.y};
-
-                rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                rlTexCoord2f(vt0.x,vt0.y);
-                rlVertex2f(v0.x, v0.y);
-
-                rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                rlTexCoord2f(vt1.x,vt1.y);
-                rlVertex2f(v1.x, v1.y);
-
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlTexCoord2f(vt2.x,vt2.y);
-                rlVertex2f(v2.x, v2.y);
-
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlTexCoord2f(vt2.x,vt2.y);
-                rlVertex2f(v2.x, v2.y);
-            }
-        rlEnd();
-
-    }
-
-    /*
-
-    if (getVertexCount() >= 1)
-    {
-     int pointCount = (int) m_vertices.size();
-
-        rlCheckRenderBatchLimit (pointCount*3);
-
-
-            rlBegin(RL_TRIANGLES);
-
-
-
-
-            for (int i = 0; i < pointCount/3 ; i++)
-            {
-
-
-                 iColor c2 =m_vertices[i * 3 + 0].color;
-                 iColor c1 =m_vertices[i * 3 + 1].color;
-                 iColor c0 =m_vertices[i * 3 + 2].color;
-
-
-
-                Vector2 v2=(Vector2){m_vertices[0].position.x,m_vertices[0].position.y};
-                Vector2 v1=(Vector2){m_vertices[i].position.x,m_vertices[i].position.y};
-                Vector2 v0=(Vector2){m_vertices[i+1].position.x,m_vertices[i+1].position.y};
-
-                Vector2 vt2=(Vector2){m_vertices[0].texCoords.x,m_vertices[0].texCoords.y};
-                Vector2 vt1=(Vector2){m_vertices[i].texCoords.x,m_vertices[i].texCoords.y};
-                Vector2 vt0=(Vector2){m_vertices[i+1].texCoords.x,m_vertices[i+1].texCoords.y};
-
-                rlColor4ub(c0.r,c0.g,c0.b,c0.a);
-                rlTexCoord2f(vt0.x,vt0.y);
-                rlVertex2f(v0.x, v0.y);
-
-                rlColor4ub(c1.r,c1.g,c1.b,c1.a);
-                rlTexCoord2f(vt1.x,vt1.y);
-                rlVertex2f(v1.x, v1.y);
-
-                rlColor4ub(c2.r,c2.g,c2.b,c2.a);
-                rlTexCoord2f(vt2.x,vt2.y);
-                rlVertex2f(v2.x, v2.y);
-
-            }
-        rlEnd();
-
-    }
-
-*/
-
-
-
-
-   rlPopMatrix();
-
-    //    target.draw(&m_vertices[0], m_vertices.size(), m_primitiveType, states);
+    target.draw(&m_vertices[0], m_vertices.size(), m_primitiveType, states);
 }
 
 } // namespace sf
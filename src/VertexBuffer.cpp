@@ -0,0 +1,599 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "VertexBuffer.hpp"
+#include "VertexArray.hpp"
+#include "RenderTarget.hpp"
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+
+namespace
+{
+    // Number of changes a buffer remembers for the targets keeping their own copy
+    const std::size_t maxChanges = 16;
+
+    // Revision numbers are unique across all the buffers, so that a buffer
+    // created where a destroyed one lived is never mistaken for it
+    sf::Uint64 nextRevision()
+    {
+        static std::atomic<sf::Uint64> counter(0);
+        return ++counter;
+    }
+
+    // Tell whether a primitive type can be stored in a GPU buffer;
+    // rlgl can only draw vertex arrays as triangle lists
+    bool isTriangleType(sf::PrimitiveType type)
+    {
+        return (type == sf::Triangles) || (type == sf::TriangleStrip) ||
+               (type == sf::TriangleFan) || (type == sf::Quads);
+    }
+
+    // Number of triangles described by vertexCount vertices
+    std::size_t getTriangleCount(sf::PrimitiveType type, std::size_t vertexCount)
+    {
+        switch (type)
+        {
+            case sf::Triangles:     return vertexCount / 3;
+            case sf::TriangleStrip:
+            case sf::TriangleFan:   return vertexCount >= 3 ? vertexCount - 2 : 0;
+            case sf::Quads:         return vertexCount / 4 * 2;
+            default:                return 0;
+        }
+    }
+
+    // Range of triangles [first, last) using at least one vertex of [begin, end)
+    void getTriangleRange(sf::PrimitiveType type, std::size_t vertexCount, std::size_t begin, std::size_t end,
+                          std::size_t& first, std::size_t& last)
+    {
+        std::size_t triangleCount = getTriangleCount(type, vertexCount);
+
+        switch (type)
+        {
+            case sf::Triangles:
+                first = begin / 3;
+                last  = (end + 2) / 3;
+                break;
+
+            case sf::TriangleStrip:
+                // Triangle i uses the vertices i, i + 1 and i + 2
+                first = begin >= 2 ? begin - 2 : 0;
+                last  = end;
+                break;
+
+            case sf::TriangleFan:
+                // Every triangle uses the center vertex
+                first = begin == 0 ? 0 : (begin >= 2 ? begin - 2 : 0);
+                last  = begin == 0 ? triangleCount : end - 1;
+                break;
+
+            case sf::Quads:
+                first = begin / 4 * 2;
+                last  = (end + 3) / 4 * 2;
+                break;
+
+            default:
+                first = last = 0;
+                break;
+        }
+
+        last  = std::min(last, triangleCount);
+        first = std::min(first, last);
+    }
+
+    // Write the three vertices of a triangle of the source primitives
+    void expandTriangle(sf::PrimitiveType type, const sf::Vertex* in, std::size_t index, sf::Vertex* out,
+                        const sf::iVector2f& texCoordScale)
+    {
+        switch (type)
+        {
+            case sf::TriangleStrip:
+                // Swap the first two vertices of every odd triangle to keep a consistent winding
+                out[0] = in[(index % 2 == 0) ? index : index + 1];
+                out[1] = in[(index % 2 == 0) ? index + 1 : index];
+                out[2] = in[index + 2];
+                break;
+
+            case sf::TriangleFan:
+                out[0] = in[0];
+                out[1] = in[index + 1];
+                out[2] = in[index + 2];
+                break;
+
+            case sf::Quads:
+            {
+                std::size_t quad = index / 2 * 4;
+                out[0] = in[quad];
+                out[1] = in[quad + 1 + index % 2];
+                out[2] = in[quad + 2 + index % 2];
+                break;
+            }
+
+            default:
+                out[0] = in[index * 3 + 0];
+                out[1] = in[index * 3 + 1];
+                out[2] = in[index * 3 + 2];
+                break;
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            out[i].texCoords.x *= texCoordScale.x;
+            out[i].texCoords.y *= texCoordScale.y;
+        }
+    }
+
+    // Describe the layout of sf::Vertex to the default shader inputs
+    void setVertexAttributes()
+    {
+        const int stride = static_cast<int>(sizeof(sf::Vertex));
+
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 2, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, position)));
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, false, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, texCoords)));
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, stride,
+                             reinterpret_cast<const void*>(offsetof(sf::Vertex, color)));
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer() :
+m_vertices     (),
+m_triangles    (),
+m_primitiveType(Points),
+m_usage        (Stream),
+m_dirtyBegin   (0),
+m_dirtyEnd     (0),
+m_revision     (nextRevision()),
+m_historyStart (m_revision),
+m_changes      (),
+m_gpuCapacity  (0),
+m_texCoordScale(1.f, 1.f),
+m_vao          (0),
+m_vbo          (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer(PrimitiveType type) :
+m_vertices     (),
+m_triangles    (),
+m_primitiveType(type),
+m_usage        (Stream),
+m_dirtyBegin   (0),
+m_dirtyEnd     (0),
+m_revision     (nextRevision()),
+m_historyStart (m_revision),
+m_changes      (),
+m_gpuCapacity  (0),
+m_texCoordScale(1.f, 1.f),
+m_vao          (0),
+m_vbo          (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer(Usage usage) :
+m_vertices     (),
+m_triangles    (),
+m_primitiveType(Points),
+m_usage        (usage),
+m_dirtyBegin   (0),
+m_dirtyEnd     (0),
+m_revision     (nextRevision()),
+m_historyStart (m_revision),
+m_changes      (),
+m_gpuCapacity  (0),
+m_texCoordScale(1.f, 1.f),
+m_vao          (0),
+m_vbo          (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer(PrimitiveType type, Usage usage) :
+m_vertices     (),
+m_triangles    (),
+m_primitiveType(type),
+m_usage        (usage),
+m_dirtyBegin   (0),
+m_dirtyEnd     (0),
+m_revision     (nextRevision()),
+m_historyStart (m_revision),
+m_changes      (),
+m_gpuCapacity  (0),
+m_texCoordScale(1.f, 1.f),
+m_vao          (0),
+m_vbo          (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer(const VertexBuffer& copy) :
+m_vertices     (copy.m_vertices),
+m_triangles    (),
+m_primitiveType(copy.m_primitiveType),
+m_usage        (copy.m_usage),
+m_dirtyBegin   (0),
+m_dirtyEnd     (copy.m_vertices.size()),
+m_revision     (nextRevision()),
+m_historyStart (m_revision),
+m_changes      (),
+m_gpuCapacity  (0),
+m_texCoordScale(1.f, 1.f),
+m_vao          (0),
+m_vbo          (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::~VertexBuffer()
+{
+    destroy();
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer& VertexBuffer::operator =(const VertexBuffer& right)
+{
+    if (this != &right)
+    {
+        destroy();
+
+        m_vertices      = right.m_vertices;
+        m_primitiveType = right.m_primitiveType;
+        m_usage         = right.m_usage;
+        m_dirtyBegin    = 0;
+        m_dirtyEnd      = m_vertices.size();
+        m_revision      = nextRevision();
+        m_historyStart  = m_revision;
+        m_changes.clear();
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::create(std::size_t vertexCount)
+{
+    m_vertices.assign(vertexCount, Vertex());
+    invalidate(0, vertexCount);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getVertexCount() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const Vertex* vertices)
+{
+    return update(vertices, m_vertices.size(), 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, std::size_t offset)
+{
+    if (!vertices)
+        return false;
+
+    if (vertexCount == 0)
+        return true;
+
+    if (offset + vertexCount > m_vertices.size())
+        m_vertices.resize(offset + vertexCount);
+
+    std::copy(vertices, vertices + vertexCount, m_vertices.begin() + offset);
+    invalidate(offset, offset + vertexCount);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const VertexArray& vertices)
+{
+    std::size_t count = vertices.getVertexCount();
+
+    if (count < m_vertices.size())
+    {
+        m_vertices.resize(count);
+        invalidate(0, count);
+    }
+
+    return (count == 0) || update(&vertices[0], count, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const VertexArray& vertices, std::size_t offset, std::size_t count)
+{
+    if (offset + count > vertices.getVertexCount())
+        return false;
+
+    return (count == 0) || update(&vertices[offset], count, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::setPrimitiveType(PrimitiveType type)
+{
+    if (type != m_primitiveType)
+    {
+        m_primitiveType = type;
+
+        // The expanded triangles depend on the primitive type
+        invalidate(0, m_vertices.size());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+PrimitiveType VertexBuffer::getPrimitiveType() const
+{
+    return m_primitiveType;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::Usage VertexBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::isAvailable()
+{
+    return rlGetVersion() != RL_OPENGL_11;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
+{
+    target.draw(*this, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::invalidate(std::size_t first, std::size_t last)
+{
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = first;
+        m_dirtyEnd   = last;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, first);
+        m_dirtyEnd   = std::max(m_dirtyEnd, last);
+    }
+
+    // Remember the change for the targets keeping their own copy of the vertices
+    if (m_changes.size() == maxChanges)
+    {
+        m_historyStart = m_changes.front().revision;
+        m_changes.erase(m_changes.begin());
+    }
+
+    m_revision = nextRevision();
+
+    Change change = {m_revision, first, last};
+    m_changes.push_back(change);
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::getChangedRange(Uint64 revision, std::size_t& first, std::size_t& last) const
+{
+    // The changes older than the history are lost: report the whole buffer
+    if (revision < m_historyStart)
+    {
+        first = 0;
+        last  = m_vertices.size();
+        return;
+    }
+
+    first = last = 0;
+    for (std::size_t i = 0; i < m_changes.size(); ++i)
+    {
+        const Change& change = m_changes[i];
+        if (change.revision <= revision)
+            continue;
+
+        if (first == last)
+        {
+            first = change.first;
+            last  = change.last;
+        }
+        else
+        {
+            first = std::min(first, change.first);
+            last  = std::max(last, change.last);
+        }
+    }
+
+    // The buffer may have shrunk since
+    last  = std::min(last, m_vertices.size());
+    first = std::min(first, last);
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::destroy()
+{
+    if (m_vbo)
+        rlUnloadVertexBuffer(m_vbo);
+
+    if (m_vao)
+        rlUnloadVertexArray(m_vao);
+
+    m_vao         = 0;
+    m_vbo         = 0;
+    m_gpuCapacity = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::upload(const iVector2f& texCoordScale) const
+{
+    std::size_t triangleCount = getTriangleCount(m_primitiveType, m_vertices.size());
+    std::size_t vertexCount   = triangleCount * 3;
+    bool        reallocate    = vertexCount > m_gpuCapacity;
+    bool        rescale       = texCoordScale != m_texCoordScale;
+
+    if ((vertexCount == 0) || ((m_dirtyBegin == m_dirtyEnd) && !reallocate && !rescale))
+        return;
+
+    // Only the triangles that changed are rebuilt, unless the whole buffer must be sent
+    std::size_t first = 0;
+    std::size_t last  = triangleCount;
+
+    if (!reallocate && !rescale)
+        getTriangleRange(m_primitiveType, m_vertices.size(), m_dirtyBegin, m_dirtyEnd, first, last);
+
+    m_triangles.resize(vertexCount);
+    for (std::size_t i = first; i < last; ++i)
+        expandTriangle(m_primitiveType, &m_vertices[0], i, &m_triangles[i * 3], texCoordScale);
+
+    if (reallocate)
+    {
+        // The buffer is too small: recreate it with the whole content.
+        // rlgl only distinguishes static and dynamic buffers, Stream maps to dynamic
+        const_cast<VertexBuffer*>(this)->destroy();
+
+        m_vao = rlLoadVertexArray();
+        rlEnableVertexArray(m_vao);
+        m_vbo = rlLoadVertexBuffer(&m_triangles[0], static_cast<int>(vertexCount * sizeof(Vertex)), m_usage != Static);
+        setVertexAttributes();
+        rlDisableVertexArray();
+
+        m_gpuCapacity = vertexCount;
+    }
+    else if (first < last)
+    {
+        rlUpdateVertexBuffer(m_vbo, &m_triangles[first * 3],
+                             static_cast<int>((last - first) * 3 * sizeof(Vertex)),
+                             static_cast<int>(first * 3 * sizeof(Vertex)));
+    }
+
+    m_texCoordScale = texCoordScale;
+    m_dirtyBegin    = 0;
+    m_dirtyEnd      = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::render(const Transform& transform, unsigned int texture, const iVector2f& texCoordScale) const
+{
+    // Lines and points can't be drawn from a buffer through rlgl
+    if (!isTriangleType(m_primitiveType) || !isAvailable())
+        return false;
+
+    upload(texCoordScale);
+
+    std::size_t vertexCount = getTriangleCount(m_primitiveType, m_vertices.size()) * 3;
+    if (vertexCount == 0)
+        return true;
+
+    // Flush what was batched so far, to preserve the drawing order
+    rlDrawRenderBatchActive();
+    rlDisableBackfaceCulling();
+
+    float matrix[16];
+    transform.getMatrix(matrix);
+    rlPushMatrix();
+    rlMultMatrixf(matrix);
+
+    // Draw with the default shader, as the batch would
+    rlEnableShader(rlGetShaderIdDefault());
+    int* locations = rlGetShaderLocsDefault();
+
+    Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    rlSetUniformMatrix(locations[RL_SHADER_LOC_MATRIX_MVP], MatrixMultiply(modelView, rlGetMatrixProjection()));
+
+    const float white[4] = {1.f, 1.f, 1.f, 1.f};
+    rlSetUniform(locations[RL_SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+
+    const int slot = 0;
+    rlSetUniform(locations[RL_SHADER_LOC_MAP_DIFFUSE], &slot, RL_SHADER_UNIFORM_SAMPLER2D, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(texture);
+
+    // Without vertex array objects, the layout has to be set before every draw
+    if (!rlEnableVertexArray(m_vao))
+    {
+        rlEnableVertexBuffer(m_vbo);
+        setVertexAttributes();
+    }
+
+    rlDrawVertexArray(0, static_cast<int>(vertexCount));
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+
+    rlPopMatrix();
+
+    return true;
+}
+
+} // namespace sf
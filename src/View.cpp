@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "View.hpp"
+#include "SinCos.hpp"
 #include <cmath>
 
 
@@ -33,12 +34,12 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 View::View() :
-m_center             (),
-m_size               (),
-m_rotation           (0),
-m_viewport           (0, 0, 1, 1),
-m_transformUpdated   (false),
-m_invTransformUpdated(false)
+m_center           (),
+m_size             (),
+m_rotation         (0),
+m_viewport         (0, 0, 1, 1),
+m_transformState   (),
+m_invTransformState()
 {
     reset(FloatRect(0, 0, 1000, 1000));
 }
@@ -46,12 +47,12 @@ m_invTransformUpdated(false)
 
 ////////////////////////////////////////////////////////////
 View::View(const FloatRect& rectangle) :
-m_center             (),
-m_size               (),
-m_rotation           (0),
-m_viewport           (0, 0, 1, 1),
-m_transformUpdated   (false),
-m_invTransformUpdated(false)
+m_center           (),
+m_size             (),
+m_rotation         (0),
+m_viewport         (0, 0, 1, 1),
+m_transformState   (),
+m_invTransformState()
 {
     reset(rectangle);
 }
@@ -59,12 +60,12 @@ m_invTransformUpdated(false)
 
 ////////////////////////////////////////////////////////////
 View::View(const iVector2f& center, const iVector2f& size) :
-m_center             (center),
-m_size               (size),
-m_rotation           (0),
-m_viewport           (0, 0, 1, 1),
-m_transformUpdated   (false),
-m_invTransformUpdated(false)
+m_center           (center),
+m_size             (size),
+m_rotation         (0),
+m_viewport         (0, 0, 1, 1),
+m_transformState   (),
+m_invTransformState()
 {
 
 }
@@ -75,8 +76,8 @@ void View::setCenter(float x, float y)
     m_center.x = x;
     m_center.y = y;
 
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    m_transformState.invalidate();
+    m_invTransformState.invalidate();
 }
 
 
@@ -93,8 +94,8 @@ void View::setSize(float width, float height)
     m_size.x = width;
     m_size.y = height;
 
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    m_transformState.invalidate();
+    m_invTransformState.invalidate();
 }
 
 
@@ -112,8 +113,8 @@ void View::setRotation(float angle)
     if (m_rotation < 0)
         m_rotation += 360.f;
 
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    m_transformState.invalidate();
+    m_invTransformState.invalidate();
 }
 
 
@@ -133,8 +134,8 @@ void View::reset(const FloatRect& rectangle)
     m_size.y   = rectangle.height;
     m_rotation = 0;
 
-    m_transformUpdated    = false;
-    m_invTransformUpdated = false;
+    m_transformState.invalidate();
+    m_invTransformState.invalidate();
 }
 
 
@@ -197,13 +198,14 @@ void View::zoom(float factor)
 ////////////////////////////////////////////////////////////
 const Transform& View::getTransform() const
 {
-    // Recompute the matrix if needed
-    if (!m_transformUpdated)
+    // Recompute the matrix if needed; concurrent callers
+    // wait for the first one to publish it
+    if (!m_transformState.isValid() && m_transformState.beginUpdate())
     {
         // Rotation components
-        float angle  = m_rotation * 3.141592654f / 180.f;
-        float cosine = static_cast<float>(std::cos(angle));
-        float sine   = static_cast<float>(std::sin(angle));
+        float sine;
+        float cosine;
+        priv::sinCosDegrees(m_rotation, sine, cosine);
         float tx     = -m_center.x * cosine - m_center.y * sine + m_center.x;
         float ty     =  m_center.x * sine - m_center.y * cosine + m_center.y;
 
@@ -217,7 +219,7 @@ const Transform& View::getTransform() const
         m_transform = Transform( a * cosine, a * sine,   a * tx + c,
                                 -b * sine,   b * cosine, b * ty + d,
                                  0.f,        0.f,        1.f);
-        m_transformUpdated = true;
+        m_transformState.endUpdate();
     }
 
     return m_transform;
@@ -228,10 +230,10 @@ const Transform& View::getTransform() const
 const Transform& View::getInverseTransform() const
 {
     // Recompute the matrix if needed
-    if (!m_invTransformUpdated)
+    if (!m_invTransformState.isValid() && m_invTransformState.beginUpdate())
     {
         m_inverseTransform = getTransform().getInverse();
-        m_invTransformUpdated = true;
+        m_invTransformState.endUpdate();
     }
 
     return m_inverseTransform;
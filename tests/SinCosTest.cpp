@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Accuracy test of sf::priv::sinCosDegrees against libm
+//
+// Every angle is computed with the scalar and the array
+// functions, which must give the same bits, and compared to
+// std::sin and std::cos in double precision. With
+// SFML_FAST_SINCOS the absolute error must stay within the
+// documented bound; without it, the results must be exactly
+// those of std::sin and std::cos in float.
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SinCos.hpp"
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+
+namespace
+{
+    // Documented bound of the absolute error of the fast path
+    const double tolerance = 1.2e-7;
+
+    // Largest angle reduced exactly by the fast path, in degrees
+    const float exactRange = 368640.f;
+
+    // Number of angles checked at once
+    const std::size_t batchSize = 1000000;
+
+    const double pi = 3.14159265358979323846;
+
+    struct Result
+    {
+        Result() : sineError(0), cosineError(0), worstAngle(0), angleCount(0), mismatches(0), failures(0) {}
+
+        double      sineError;   // Largest absolute error of the sines
+        double      cosineError; // Largest absolute error of the cosines
+        float       worstAngle;  // Angle with the largest error
+        std::size_t angleCount;  // Number of angles checked
+        std::size_t mismatches;  // Angles where the array and scalar functions differ
+        std::size_t failures;    // Angles outside of the expected accuracy
+    };
+
+    // Checks a batch of finite angles
+    void check(const std::vector<float>& angles, Result& result)
+    {
+        std::vector<float> sines(angles.size());
+        std::vector<float> cosines(angles.size());
+        sf::priv::sinCosDegrees(&angles[0], &sines[0], &cosines[0], angles.size());
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            float sine;
+            float cosine;
+            sf::priv::sinCosDegrees(angles[i], sine, cosine);
+
+            if ((std::memcmp(&sine, &sines[i], sizeof(float)) != 0) || (std::memcmp(&cosine, &cosines[i], sizeof(float)) != 0))
+                ++result.mismatches;
+
+            // std::fmod is exact, so the reference is the true value up to double rounding
+            double radians     = std::fmod(static_cast<double>(angles[i]), 360.0) * pi / 180.0;
+            double sineError   = std::fabs(sine - std::sin(radians));
+            double cosineError = std::fabs(cosine - std::cos(radians));
+
+            if (std::max(sineError, cosineError) > std::max(result.sineError, result.cosineError))
+                result.worstAngle = angles[i];
+            result.sineError   = std::max(result.sineError, sineError);
+            result.cosineError = std::max(result.cosineError, cosineError);
+
+#ifdef SFML_FAST_SINCOS
+            if ((sineError > tolerance) || (cosineError > tolerance))
+                ++result.failures;
+#else
+            float angle          = angles[i] * 3.141592654f / 180.f;
+            float expectedSine   = std::sin(angle);
+            float expectedCosine = std::cos(angle);
+            if ((std::memcmp(&sine, &expectedSine, sizeof(float)) != 0) || (std::memcmp(&cosine, &expectedCosine, sizeof(float)) != 0))
+                ++result.failures;
+#endif
+        }
+
+        result.angleCount += angles.size();
+    }
+
+    // Checks angles that have no sine nor cosine; their results must be NaN
+    void checkSpecial(Result& result)
+    {
+        const float nan      = std::numeric_limits<float>::quiet_NaN();
+        const float infinity = std::numeric_limits<float>::infinity();
+
+        // Mixed with regular angles, so that the array function meets them in every lane
+        const float angles[] = {nan, 10.f, 20.f, 30.f, 40.f, infinity, 60.f, 70.f,
+                                80.f, 90.f, -infinity, 110.f, 120.f, 130.f, 140.f, -nan};
+        const std::size_t count = sizeof(angles) / sizeof(angles[0]);
+
+        float sines[count];
+        float cosines[count];
+        sf::priv::sinCosDegrees(angles, sines, cosines, count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float sine;
+            float cosine;
+            sf::priv::sinCosDegrees(angles[i], sine, cosine);
+
+            if ((std::memcmp(&sine, &sines[i], sizeof(float)) != 0) || (std::memcmp(&cosine, &cosines[i], sizeof(float)) != 0))
+                ++result.mismatches;
+
+            if (std::isfinite(angles[i]))
+                continue;
+
+            if (!std::isnan(sine) || !std::isnan(cosine))
+            {
+                std::printf("sinCosDegrees(%g) gave (%g, %g) instead of NaN\n", angles[i], sine, cosine);
+                ++result.failures;
+            }
+        }
+
+        result.angleCount += count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    Result exact;
+    Result huge;
+    std::vector<float> angles;
+    angles.reserve(batchSize);
+
+    // Regular sweep of the range reduced exactly, in both directions
+    const long sweepCount = 20000000;
+    for (long i = 0; i <= sweepCount; ++i)
+    {
+        angles.push_back(static_cast<float>(-exactRange + 2.0 * exactRange * i / sweepCount));
+        if (angles.size() == batchSize)
+        {
+            check(angles, exact);
+            angles.clear();
+        }
+    }
+
+    // Dense sweep of the first two turns, both ways
+    for (long i = -7200000; i <= 7200000; ++i)
+    {
+        angles.push_back(i * 0.0001f);
+        if (angles.size() == batchSize)
+        {
+            check(angles, exact);
+            angles.clear();
+        }
+    }
+
+    // Limits of the exact reduction
+    angles.push_back(exactRange);
+    angles.push_back(-exactRange);
+    angles.push_back(std::nextafter(exactRange, 0.f));
+    angles.push_back(std::nextafter(-exactRange, 0.f));
+    check(angles, exact);
+    angles.clear();
+
+    // Angles reduced with std::fmod first, including the ones whose fmod is negative
+    const float hugeAngles[] = {std::nextafter(exactRange, FLT_MAX), std::nextafter(-exactRange, -FLT_MAX),
+                                1e6f, -1e6f, 1e7f, -1e7f, 123456789.f, -123456789.f, 3e9f, -3e9f,
+                                1e20f, -1e20f, 1e30f, -1e30f, FLT_MAX, -FLT_MAX};
+    angles.assign(hugeAngles, hugeAngles + sizeof(hugeAngles) / sizeof(hugeAngles[0]));
+    for (int i = 1; i <= 100000; ++i)
+    {
+        angles.push_back(exactRange + i * 3.7f);
+        angles.push_back(-exactRange - i * 3.7f);
+    }
+    check(angles, huge);
+
+    checkSpecial(huge);
+
+#ifdef SFML_FAST_SINCOS
+    std::printf("Fast path (SFML_FAST_SINCOS), documented bound %.3g\n", tolerance);
+#else
+    std::printf("Default path, checked against std::sin and std::cos in float\n");
+#endif
+    std::printf("|angle| <= %g: %lu angles, max error sin %.3g cos %.3g (worst at %g)\n", exactRange,
+                static_cast<unsigned long>(exact.angleCount), exact.sineError, exact.cosineError, exact.worstAngle);
+    std::printf("|angle| >  %g: %lu angles, max error sin %.3g cos %.3g (worst at %g)\n", exactRange,
+                static_cast<unsigned long>(huge.angleCount), huge.sineError, huge.cosineError, huge.worstAngle);
+    std::printf("Array and scalar results differing: %lu\n",
+                static_cast<unsigned long>(exact.mismatches + huge.mismatches));
+
+    std::size_t failures = exact.failures + huge.failures + exact.mismatches + huge.mismatches;
+    std::printf("%s (%lu failures)\n", (failures == 0) ? "PASSED" : "FAILED", static_cast<unsigned long>(failures));
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
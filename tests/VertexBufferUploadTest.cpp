@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Test of the vertex buffer uploads recorded by
+// sf::HeadlessRenderTarget
+//
+// A buffer must be recorded as uploaded once per change,
+// whatever the number of times it is drawn, with the range of
+// vertices modified since the target last drew it.
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "HeadlessRenderTarget.hpp"
+#include "TileMap.hpp"
+#include "VertexBuffer.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+namespace
+{
+    int failures = 0;
+
+    // Checks the uploads recorded since the last clear of the target
+    void checkUploads(const char* name, sf::HeadlessRenderTarget& target, std::size_t count,
+                      std::size_t offset = 0, std::size_t vertexCount = 0)
+    {
+        const std::vector<sf::HeadlessRenderTarget::Upload>& uploads = target.getUploads();
+
+        bool passed = (uploads.size() == count);
+        if (passed && (count == 1))
+            passed = (uploads[0].offset == offset) && (uploads[0].vertexCount == vertexCount);
+
+        std::printf("%-48s %s\n", name, passed ? "passed" : "FAILED");
+        if (!passed)
+        {
+            for (std::size_t i = 0; i < uploads.size(); ++i)
+                std::printf("    upload %lu: offset %lu, %lu vertices\n", static_cast<unsigned long>(i),
+                            static_cast<unsigned long>(uploads[i].offset), static_cast<unsigned long>(uploads[i].vertexCount));
+            ++failures;
+        }
+
+        target.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::HeadlessRenderTarget target(800, 600);
+
+    std::vector<sf::Vertex> vertices(300);
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertices[i].position = sf::iVector2f(static_cast<float>(i), static_cast<float>(i % 7));
+
+    sf::VertexBuffer buffer(sf::Triangles, sf::VertexBuffer::Static);
+    buffer.update(&vertices[0], vertices.size(), 0);
+
+    // The first draw uploads the whole buffer, the second one nothing
+    target.draw(buffer);
+    target.draw(buffer);
+    checkUploads("Updated buffer drawn twice: one upload", target, 1, 0, 300);
+
+    target.draw(buffer);
+    checkUploads("Unchanged buffer: no upload", target, 0);
+
+    buffer.update(&vertices[30], 6, 30);
+    target.draw(buffer);
+    target.draw(buffer);
+    checkUploads("Partial update: only the modified range", target, 1, 30, 6);
+
+    buffer.update(&vertices[12], 3, 12);
+    buffer.update(&vertices[90], 3, 90);
+    target.draw(buffer);
+    checkUploads("Two updates: the range spanning both", target, 1, 12, 81);
+
+    for (std::size_t i = 0; i < 20; ++i)
+        buffer.update(&vertices[i * 3], 3, i * 3);
+    target.draw(buffer);
+    checkUploads("More updates than remembered: whole buffer", target, 1, 0, 300);
+
+    // Every target keeps its own copy of the buffer
+    sf::HeadlessRenderTarget other(800, 600);
+    other.draw(buffer);
+    checkUploads("Second target: whole buffer", other, 1, 0, 300);
+    target.draw(buffer);
+    checkUploads("First target: nothing new", target, 0);
+
+    // A tile map drawn frame after frame only uploads its chunks once
+    std::vector<int> tiles(256 * 256, 0);
+    Texture2D tileset = Texture2D();
+    tileset.id     = 1;
+    tileset.width  = 64;
+    tileset.height = 64;
+
+    sf::TileMap map;
+    map.load(tileset, sf::iVector2u(16, 16), &tiles[0], 256, 256);
+
+    target.draw(map);
+    bool wholeChunks = (target.getUploads().size() == target.getDrawCalls().size()) && !target.getUploads().empty();
+    for (std::size_t i = 0; i < target.getUploads().size(); ++i)
+        wholeChunks = wholeChunks && (target.getUploads()[i].vertexCount == 32 * 32 * 4);
+    std::printf("%-48s %s\n", "Tile map, first frame: one upload per chunk", wholeChunks ? "passed" : "FAILED");
+    failures += wholeChunks ? 0 : 1;
+    target.clear();
+
+    target.draw(map);
+    target.draw(map);
+    checkUploads("Tile map, next frames: no upload", target, 0);
+
+    map.setTile(5, 5, 1);
+    target.draw(map);
+    checkUploads("Tile map, one tile changed: its four vertices", target, 1, (5 + 5 * 32) * 4, 4);
+
+    std::printf("%s (%d failures)\n", (failures == 0) ? "PASSED" : "FAILED", failures);
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}